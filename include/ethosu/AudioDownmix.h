@@ -0,0 +1,67 @@
+#ifndef AUDIODOWNMIX_H
+#define AUDIODOWNMIX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+#include <arm_acle.h>
+#endif
+
+/**
+ * @brief Capture block to mono conversion, writing straight into the analysis buffer.
+ *
+ * Meant to run once per received DMA block, from the driver buffer to its place in the audio
+ * ring, so that samples are touched a single time between the peripheral and the features:
+ *
+ *   AudioDownmixStereo: interleaved L/R to (L + R) / 2 * gain
+ *   AudioApplyGain:     mono (channel picked by the peripheral) to sample * gain
+ *
+ * Results saturate to int16. With the DSP extension, a stereo frame costs one SMUAD (both
+ * channels times the gain, summed) and one SSAT. Buffers only need 2-byte alignment.
+ */
+
+static inline int16_t AudioSaturate16(int32_t value)
+{
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+	return static_cast<int16_t>(__ssat(value, 16));
+#else
+	return static_cast<int16_t>(value > INT16_MAX ? INT16_MAX
+						      : (value < INT16_MIN ? INT16_MIN : value));
+#endif
+}
+
+/* gain up to INT16_MAX, frames stereo frames in, frames samples out */
+static inline void AudioDownmixStereo(const int16_t *in, int16_t *out, size_t frames,
+				      int32_t gain)
+{
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+	const uint32_t gainPair = (static_cast<uint32_t>(gain) << 16) | static_cast<uint32_t>(gain);
+
+	for (size_t i = 0; i < frames; i++) {
+		uint32_t frame;
+
+		memcpy(&frame, in + 2 * i, sizeof(frame));
+		out[i] = AudioSaturate16(__smuad(frame, gainPair) >> 1);
+	}
+#else
+	for (size_t i = 0; i < frames; i++) {
+		out[i] = AudioSaturate16(((in[2 * i] + in[2 * i + 1]) * gain) >> 1);
+	}
+#endif
+}
+
+static inline void AudioApplyGain(const int16_t *in, int16_t *out, size_t samples, int32_t gain)
+{
+	if (gain == 1) {
+		memmove(out, in, samples * sizeof(int16_t));
+		return;
+	}
+
+	for (size_t i = 0; i < samples; i++) {
+		out[i] = AudioSaturate16(in[i] * gain);
+	}
+}
+
+#endif /* AUDIODOWNMIX_H */
@@ -0,0 +1,135 @@
+#ifndef AUDIORINGBUFFER_H
+#define AUDIORINGBUFFER_H
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief AudioRingWindow: read only view of a window of samples held in an AudioRingBuffer.
+ *
+ * The window may wrap around the end of the ring storage, in which case it is made of two
+ * contiguous pieces. Nothing is copied when the view is created, samples are read in place
+ * with operator[] or copied out with CopyTo(), at most two memcpy per call.
+ */
+template <typename T> class AudioRingWindow
+{
+public:
+	AudioRingWindow() = default;
+
+	AudioRingWindow(const T *storage, size_t capacity, size_t start, size_t length)
+		: m_storage(storage), m_capacity(capacity), m_start(start), m_length(length)
+	{
+	}
+
+	size_t Size() const
+	{
+		return m_length;
+	}
+
+	const T &operator[](size_t index) const
+	{
+		return m_storage[Position(index)];
+	}
+
+	/* Samples [offset, offset + count) do not straddle the end of the ring storage */
+	bool IsContiguous(size_t offset, size_t count) const
+	{
+		return Position(offset) + count <= m_capacity;
+	}
+
+	/* Pointer to the sample at offset, [offset, offset + count) must be contiguous */
+	const T *Data(size_t offset) const
+	{
+		return m_storage + Position(offset);
+	}
+
+	void CopyTo(size_t offset, size_t count, T *dst) const
+	{
+		const size_t pos = Position(offset);
+		const size_t first = count < m_capacity - pos ? count : m_capacity - pos;
+
+		memcpy(dst, m_storage + pos, first * sizeof(T));
+		memcpy(dst + first, m_storage, (count - first) * sizeof(T));
+	}
+
+private:
+	size_t Position(size_t index) const
+	{
+		const size_t pos = m_start + index;
+
+		return pos < m_capacity ? pos : pos - m_capacity;
+	}
+
+	const T *m_storage = nullptr;
+	size_t m_capacity = 0;
+	size_t m_start = 0;
+	size_t m_length = 0;
+};
+
+/**
+ * @brief AudioRingBuffer: circular sample buffer sliding an analysis window without moving data.
+ *
+ * The producer writes new samples in place at GetWritePointer() (e.g. as a DMA or driver
+ * destination) and publishes them with Commit(). The consumer takes a view of the latest
+ * samples with GetWindow(). Sliding the window by a stride costs a Commit() instead of moving
+ * the retained samples down the buffer.
+ *
+ * Samples not written yet read as the initial storage content, so the first windows are
+ * zero padded when the storage is zero initialised.
+ *
+ * @note When the capacity is a multiple of the write size, writes never wrap and the write
+ *       pointer is always valid for a whole stride. Writing into the ring overwrites the
+ *       oldest samples: the capacity must cover the window plus any write in flight.
+ *
+ * @example
+ *   static int16_t storage[WINDOW + STRIDE];
+ *   AudioRingBuffer<int16_t> ring(storage, WINDOW + STRIDE);
+ *
+ *   capture(ring.GetWritePointer(), STRIDE);
+ *   ring.Commit(STRIDE);
+ *   AudioRingWindow<int16_t> window = ring.GetWindow(WINDOW);
+ */
+template <typename T> class AudioRingBuffer
+{
+public:
+	AudioRingBuffer(T *storage, size_t capacity) : m_storage(storage), m_capacity(capacity)
+	{
+	}
+
+	size_t GetCapacity() const
+	{
+		return m_capacity;
+	}
+
+	T *GetWritePointer() const
+	{
+		return m_storage + m_head;
+	}
+
+	/* Samples writable at GetWritePointer() before the end of the storage */
+	size_t GetContiguousSpace() const
+	{
+		return m_capacity - m_head;
+	}
+
+	void Commit(size_t count)
+	{
+		m_head = (m_head + count) % m_capacity;
+	}
+
+	/* View of the last length committed samples, oldest first */
+	AudioRingWindow<T> GetWindow(size_t length) const
+	{
+		const size_t start = m_head + m_capacity - length;
+
+		return AudioRingWindow<T>(m_storage, m_capacity,
+					  start < m_capacity ? start : start - m_capacity, length);
+	}
+
+private:
+	T *m_storage;
+	size_t m_capacity;
+	size_t m_head = 0;
+};
+
+#endif /* AUDIORINGBUFFER_H */
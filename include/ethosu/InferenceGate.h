@@ -0,0 +1,31 @@
+#ifndef INFERENCEGATE_H
+#define INFERENCEGATE_H
+
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Optional model hook letting the inference runners skip inference of an input.
+ *
+ * A model may define bool IsInferenceNeeded(), called by the runners right after PreProcess()
+ * from the same thread. Returning false drops the input before RunInference() (e.g. no voice in
+ * the audio just captured). Models without it have every input inferred.
+ */
+template <typename Model, typename = void> struct HasInferenceGate : std::false_type {
+};
+
+template <typename Model>
+struct HasInferenceGate<Model, std::void_t<decltype(std::declval<Model &>().IsInferenceNeeded())>>
+	: std::true_type {
+};
+
+template <typename Model> bool IsInferenceNeeded(Model &model)
+{
+	if constexpr (HasInferenceGate<Model>::value) {
+		return model.IsInferenceNeeded();
+	} else {
+		return true;
+	}
+}
+
+#endif /* INFERENCEGATE_H */
@@ -3,6 +3,8 @@
 
 #include <zephyr/kernel.h>
 
+#include "InferenceGate.h"
+
 /**
  * @brief InferenceRunner: A reusable threaded inference loop for embedded ML using Zephyr RTOS.
  *
@@ -21,6 +23,9 @@
  *                        void* GetInputBuffer(); // Returns pointer to buffer of InputSize bytes
  *                        auto GetResult();       // Returns processed inference result
  *                        ----------------------------------------
+ *                        Optional:
+ *                        bool IsInferenceNeeded(); // false skips the input, see InferenceGate.h
+ *                        ----------------------------------------
  *                        Notes:
  *                        - InputSize must exactly match Input::OutputSize.
  *
@@ -125,6 +130,10 @@ private:
 				break;
 			}
 
+			if (!IsInferenceNeeded(m_model)) {
+				continue;
+			}
+
 			if (!m_model.RunInference()) {
 				break;
 			}
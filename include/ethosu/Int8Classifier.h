@@ -0,0 +1,157 @@
+#ifndef INT8CLASSIFIER_H
+#define INT8CLASSIFIER_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Int8Classifier: allocation free top-N and softmax on int8 classifier logits.
+ *
+ * Dequantization and softmax are monotonic, so the ranking is done on the raw int8 logits and
+ * float is only used for the scores of the reported classes. Both go through lookup tables
+ * built once per output quantization:
+ *
+ *   dequant[q] = scale * (q - zeroPoint)
+ *   exp[d]     = exp(-scale * d) in Q16, d = max logit - q
+ *
+ * Softmax of class i is exp[max - q_i] / sum_j exp[max - q_j], the sum being integer.
+ *
+ * @note Per-axis quantized outputs are not supported.
+ *
+ * @example
+ *   Int8Classifier classifier;
+ *   Int8Classifier::Result top[3];
+ *
+ *   classifier.Init(tensor->params.scale, tensor->params.zero_point);
+ *   size_t n = classifier.GetTopN(tensor->data.int8, tensor->bytes, top, 3, true);
+ */
+class Int8Classifier
+{
+public:
+	struct Result {
+		uint32_t index;
+		int8_t logit;
+		float score;
+	};
+
+	/* Build the lookup tables, only when the quantization parameters changed */
+	void Init(float scale, int32_t zeroPoint)
+	{
+		if (m_initialised && scale == m_scale && zeroPoint == m_zeroPoint) {
+			return;
+		}
+
+		for (int q = INT8_MIN; q <= INT8_MAX; q++) {
+			m_dequant[q - INT8_MIN] = scale * static_cast<float>(q - zeroPoint);
+		}
+
+		for (int d = 0; d < LutSize; d++) {
+			m_exp[d] = static_cast<uint32_t>(
+				lroundf(expf(-scale * static_cast<float>(d)) * ExpOne));
+		}
+
+		m_scale = scale;
+		m_zeroPoint = zeroPoint;
+		m_initialised = true;
+	}
+
+	float Dequantize(int8_t logit) const
+	{
+		return m_dequant[logit - INT8_MIN];
+	}
+
+	/**
+	 * @brief Pick the topN highest logits, highest first, lowest index first on ties.
+	 *
+	 * @return Number of results, min(topN, count).
+	 */
+	size_t GetTopN(const int8_t *logits, size_t count, Result *results, size_t topN,
+		       bool softmax) const
+	{
+		const size_t n = topN < count ? topN : count;
+
+		/* Nothing to keep, results[n - 1] below does not exist */
+		if (n == 0) {
+			return 0;
+		}
+
+		size_t filled = 0;
+
+		for (size_t i = 0; i < count; i++) {
+			const int8_t logit = logits[i];
+
+			if (filled == n && logit <= results[n - 1].logit) {
+				continue;
+			}
+
+			/* Insertion into the sorted results, dropping the last one when full */
+			size_t pos = filled < n ? filled++ : n - 1;
+
+			while (pos > 0 && results[pos - 1].logit < logit) {
+				results[pos] = results[pos - 1];
+				pos--;
+			}
+
+			results[pos] = {static_cast<uint32_t>(i), logit, 0.0f};
+		}
+
+		const uint64_t sum = softmax ? ExpSum(logits, count, results[0].logit) : 0;
+
+		for (size_t i = 0; i < n; i++) {
+			results[i].score = softmax ? Probability(results[i].logit, results[0].logit, sum)
+						   : Dequantize(results[i].logit);
+		}
+
+		return n;
+	}
+
+	/* Softmax of all classes, for callers that need every score */
+	void Softmax(const int8_t *logits, size_t count, float *scores) const
+	{
+		if (count == 0) {
+			return;
+		}
+
+		int8_t max = logits[0];
+
+		for (size_t i = 1; i < count; i++) {
+			max = logits[i] > max ? logits[i] : max;
+		}
+
+		const uint64_t sum = ExpSum(logits, count, max);
+
+		for (size_t i = 0; i < count; i++) {
+			scores[i] = Probability(logits[i], max, sum);
+		}
+	}
+
+private:
+	static constexpr int LutSize = 256;
+	static constexpr float ExpOne = 65536.0f;
+
+	uint64_t ExpSum(const int8_t *logits, size_t count, int8_t max) const
+	{
+		uint64_t sum = 0;
+
+		for (size_t i = 0; i < count; i++) {
+			sum += m_exp[max - logits[i]];
+		}
+
+		return sum;
+	}
+
+	float Probability(int8_t logit, int8_t max, uint64_t sum) const
+	{
+		/* The max logit contributes ExpOne, the sum is never 0 */
+		return static_cast<float>(m_exp[max - logit]) / static_cast<float>(sum);
+	}
+
+	float m_dequant[LutSize];
+	uint32_t m_exp[LutSize];
+	float m_scale = 0.0f;
+	int32_t m_zeroPoint = 0;
+	bool m_initialised = false;
+};
+
+#endif /* INT8CLASSIFIER_H */
@@ -0,0 +1,226 @@
+#ifndef PIPELINEDINFERENCERUNNER_H
+#define PIPELINEDINFERENCERUNNER_H
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include "InferenceGate.h"
+
+/**
+ * @brief Slot acquisition policy of PipelinedInferenceRunner when all slots are busy.
+ */
+enum class PipelinePolicy {
+	/* Input thread waits until the inference thread releases a slot, no input is lost */
+	BackPressure,
+	/* Input thread reuses the oldest slot still waiting for inference, latency stays bounded */
+	DropOldest,
+};
+
+/**
+ * @brief PipelinedInferenceRunner: InferenceRunner variant overlapping CPU and NPU work.
+ *
+ * Runs the pipeline in two Zephyr threads sharing two preprocessed input slots:
+ *
+ *   input thread:     GetInputData -> PreProcess(slot)          (frame N+1)
+ *   inference thread: RunInference(slot) -> PostProcess -> out  (frame N)
+ *
+ * The inference thread sleeps while the NPU runs, so preprocessing of the next frame executes
+ * in parallel with NPU execution of the current one. Postprocessing stays on the inference
+ * thread because it reads the model output tensor, which the next inference overwrites.
+ *
+ * @tparam Model          Same interface as for InferenceRunner, plus:
+ *                        ----------------------------------------
+ *                        static constexpr size_t FeatureSize; // Preprocessed data, in bytes
+ *                        bool PreProcess(void* features);     // Preprocess into a slot
+ *                        bool RunInference(const void* features); // Load slot and invoke
+ *                        ----------------------------------------
+ *                        Notes:
+ *                        - GetInputBuffer(), PreProcess() and the optional IsInferenceNeeded()
+ *                          are called from the input thread,
+ *                          RunInference(), PostProcess() and GetResult() from the inference
+ *                          thread. Both groups must not share state.
+ *
+ * @tparam Input          See InferenceRunner. Stop() may be called from any thread to
+ *                        unblock GetInputData().
+ * @tparam OutputHandler  See InferenceRunner. Called in the inference thread context.
+ * @tparam Policy         Behaviour when no slot is free, see PipelinePolicy.
+ * @tparam StackSize      Stack size of each of the two threads (default: 2024 bytes).
+ * @tparam ThreadPriority Zephyr priority of both threads (default: 10).
+ *
+ * @example
+ *   PipelinedInferenceRunner<MyModel, MyInput, MyOutputHandler<MyModel::Result>,
+ *                            PipelinePolicy::DropOldest> runner;
+ *   runner.Start();
+ */
+
+template <typename Model, typename Input, typename OutputHandler,
+	PipelinePolicy Policy = PipelinePolicy::BackPressure, size_t StackSize = 2024,
+	int ThreadPriority = 10>
+class PipelinedInferenceRunner
+{
+public:
+	static_assert(Model::InputSize == Input::OutputSize);
+
+	static constexpr uint8_t NumSlots = 2;
+
+	struct Stats {
+		uint32_t completed;
+		uint32_t dropped;
+	};
+
+	PipelinedInferenceRunner()
+	{
+		k_msgq_init(&m_freeQueue, m_freeQueueBuffer, sizeof(uint8_t), NumSlots);
+		/* One extra entry for the stop marker */
+		k_msgq_init(&m_readyQueue, m_readyQueueBuffer, sizeof(uint8_t), NumSlots + 1);
+
+		for (uint8_t slot = 0; slot < NumSlots; slot++) {
+			k_msgq_put(&m_freeQueue, &slot, K_NO_WAIT);
+		}
+	}
+
+	PipelinedInferenceRunner(const PipelinedInferenceRunner &) = delete;
+	PipelinedInferenceRunner &operator=(const PipelinedInferenceRunner &) = delete;
+	PipelinedInferenceRunner(PipelinedInferenceRunner &&) = delete;
+	PipelinedInferenceRunner &operator=(PipelinedInferenceRunner &&) = delete;
+
+	~PipelinedInferenceRunner()
+	{
+		if (!m_started) {
+			return;
+		}
+
+		atomic_set(&m_stop, 1);
+		m_input.Stop();
+		k_thread_join(&m_inputThread, K_FOREVER);
+		k_thread_join(&m_inferenceThread, K_FOREVER);
+	}
+
+	void Start(void)
+	{
+		if (m_started) {
+			return;
+		}
+
+		m_started = true;
+
+		k_thread_create(&m_inferenceThread, m_inferenceStack,
+				K_THREAD_STACK_SIZEOF(m_inferenceStack), InferenceEntry, this, NULL,
+				NULL, ThreadPriority, 0, K_NO_WAIT);
+		k_thread_create(&m_inputThread, m_inputStack, K_THREAD_STACK_SIZEOF(m_inputStack),
+				InputEntry, this, NULL, NULL, ThreadPriority, 0, K_NO_WAIT);
+	}
+
+	Stats GetStats(void) const
+	{
+		return {static_cast<uint32_t>(atomic_get(&m_completed)),
+			static_cast<uint32_t>(atomic_get(&m_dropped))};
+	}
+
+private:
+	static void InputEntry(void *ctx, void *, void *)
+	{
+		static_cast<PipelinedInferenceRunner *>(ctx)->RunInput();
+	}
+
+	static void InferenceEntry(void *ctx, void *, void *)
+	{
+		static_cast<PipelinedInferenceRunner *>(ctx)->RunInference();
+	}
+
+	bool AcquireSlot(uint8_t &slot)
+	{
+		if (k_msgq_get(&m_freeQueue, &slot, K_NO_WAIT) == 0) {
+			return true;
+		}
+
+		if (Policy == PipelinePolicy::DropOldest &&
+		    k_msgq_get(&m_readyQueue, &slot, K_NO_WAIT) == 0) {
+			atomic_inc(&m_dropped);
+			return true;
+		}
+
+		return k_msgq_get(&m_freeQueue, &slot, K_FOREVER) == 0;
+	}
+
+	void RunInput(void)
+	{
+		if (m_model.Init() && m_input.Start()) {
+			while (!atomic_get(&m_stop)) {
+				uint8_t slot;
+
+				if (!m_input.GetInputData(m_model.GetInputBuffer())) {
+					break;
+				}
+
+				if (!AcquireSlot(slot)) {
+					break;
+				}
+
+				if (!m_model.PreProcess(m_slots[slot])) {
+					k_msgq_put(&m_freeQueue, &slot, K_NO_WAIT);
+					break;
+				}
+
+				if (!IsInferenceNeeded(m_model)) {
+					k_msgq_put(&m_freeQueue, &slot, K_NO_WAIT);
+					continue;
+				}
+
+				k_msgq_put(&m_readyQueue, &slot, K_FOREVER);
+			}
+
+			m_input.Stop();
+		}
+
+		/* Let the inference thread drain the pending slots and exit */
+		uint8_t stop = NumSlots;
+		k_msgq_put(&m_readyQueue, &stop, K_FOREVER);
+	}
+
+	void RunInference(void)
+	{
+		uint8_t slot;
+
+		while (k_msgq_get(&m_readyQueue, &slot, K_FOREVER) == 0) {
+			if (slot >= NumSlots) {
+				break;
+			}
+
+			const bool ok = m_model.RunInference(m_slots[slot]);
+
+			/* The slot is consumed once the input tensor is loaded and invoked */
+			k_msgq_put(&m_freeQueue, &slot, K_NO_WAIT);
+
+			if (!ok || !m_model.PostProcess()) {
+				/* Unblock the input thread, it posts the stop marker */
+				atomic_set(&m_stop, 1);
+				m_input.Stop();
+				break;
+			}
+
+			m_outputHandler.ProcessOutput(m_model.GetResult());
+			atomic_inc(&m_completed);
+		}
+	}
+
+private:
+	Model m_model;
+	Input m_input;
+	OutputHandler m_outputHandler;
+	alignas(16) uint8_t m_slots[NumSlots][Model::FeatureSize];
+	char m_freeQueueBuffer[NumSlots];
+	char m_readyQueueBuffer[NumSlots + 1];
+	struct k_msgq m_freeQueue;
+	struct k_msgq m_readyQueue;
+	K_KERNEL_STACK_MEMBER(m_inputStack, StackSize);
+	K_KERNEL_STACK_MEMBER(m_inferenceStack, StackSize);
+	struct k_thread m_inputThread;
+	struct k_thread m_inferenceThread;
+	atomic_t m_stop = ATOMIC_INIT(0);
+	atomic_t m_completed = ATOMIC_INIT(0);
+	atomic_t m_dropped = ATOMIC_INIT(0);
+	bool m_started = false;
+};
+
+#endif /* PIPELINEDINFERENCERUNNER_H */
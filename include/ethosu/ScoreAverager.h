@@ -0,0 +1,95 @@
+#ifndef SCOREAVERAGER_H
+#define SCOREAVERAGER_H
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief ScoreAverager: fixed capacity moving average of classifier scores.
+ *
+ * Keeps the scores of the last windowLength inferences in a ring of static arrays, the oldest
+ * being overwritten by each new one, so smoothing the output of a classifier running for days
+ * never touches the heap. The window starts filled with zeros, as the averaged scores of the
+ * first inferences are damped until it has filled up.
+ *
+ * The mean is recomputed over the window on each push, windowLength * numClasses additions,
+ * rather than kept as a running sum which would drift in float over long uptimes.
+ *
+ * @example
+ *   ScoreAverager<16, 8> averager;
+ *   float scores[12];
+ *
+ *   averager.Init(12, 3);
+ *   averager.Push(scores, scores);
+ */
+template <size_t MaxClasses, size_t MaxWindowLength> class ScoreAverager
+{
+public:
+	/**
+	 * @brief Set the window geometry and clear the history.
+	 *
+	 * @return false if the geometry exceeds the capacity, the averager is then unusable.
+	 */
+	bool Init(size_t numClasses, size_t windowLength)
+	{
+		if (numClasses == 0 || numClasses > MaxClasses || windowLength == 0 ||
+		    windowLength > MaxWindowLength) {
+			m_numClasses = 0;
+			m_windowLength = 0;
+			return false;
+		}
+
+		m_numClasses = numClasses;
+		m_windowLength = windowLength;
+		Reset();
+
+		return true;
+	}
+
+	/* Forget the history, the window is filled with zeros again */
+	void Reset()
+	{
+		memset(m_history, 0, sizeof(m_history));
+		m_oldest = 0;
+	}
+
+	/**
+	 * @brief Replace the oldest scores of the window and compute the new average.
+	 *
+	 * @param scores numClasses scores of the latest inference.
+	 * @param average numClasses averages, may be scores.
+	 */
+	void Push(const float *scores, float *average)
+	{
+		memcpy(m_history[m_oldest], scores, m_numClasses * sizeof(float));
+		m_oldest = m_oldest + 1 == m_windowLength ? 0 : m_oldest + 1;
+
+		for (size_t j = 0; j < m_numClasses; j++) {
+			float sum = 0;
+
+			for (size_t i = 0; i < m_windowLength; i++) {
+				sum += m_history[i][j];
+			}
+			average[j] = sum / m_windowLength;
+		}
+	}
+
+	size_t GetNumClasses() const
+	{
+		return m_numClasses;
+	}
+
+	size_t GetWindowLength() const
+	{
+		return m_windowLength;
+	}
+
+private:
+	float m_history[MaxWindowLength][MaxClasses] = {};
+	size_t m_numClasses = 0;
+	size_t m_windowLength = 0;
+	/* Ring position of the oldest scores */
+	size_t m_oldest = 0;
+};
+
+#endif /* SCOREAVERAGER_H */
@@ -0,0 +1,224 @@
+#ifndef VOICEACTIVITYDETECTOR_H
+#define VOICEACTIVITYDETECTOR_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief VoiceActivityDetector: energy and zero-crossing voice activity detector for 16-bit PCM.
+ *
+ * Meant to gate feature extraction and inference of a keyword spotter: the caller feeds every
+ * captured block of samples to Process() and only runs the pipeline when it returns true.
+ * Integer only per frame: one pass over the samples for the mean, one for energy and crossings.
+ *
+ * Each frame is voiced when, DC removed:
+ *
+ *   energy > snr * noise floor  and  energy > minEnergy
+ *   and (zero crossings <= maxZeroCrossingPercent of the frame  or  energy > 4 * snr * floor)
+ *
+ * The zero crossing test rejects hiss-like noise bursts, loud fricatives still pass on energy.
+ * The noise floor follows unvoiced frames, quickly down and slowly up, and creeps up during
+ * voiced frames so that a persistent louder background is eventually learnt.
+ *
+ * Voice becomes active after onsetFrames consecutive voiced frames and stays active for
+ * hangoverFrames after the last voiced one, so trailing syllables and the inference windows
+ * still holding the keyword are not cut.
+ *
+ * @example
+ *   VoiceActivityDetector::Config config;
+ *   config.frameLength = 320;
+ *   VoiceActivityDetector vad(config);
+ *
+ *   if (vad.Process(stride, STRIDE)) {
+ *       run_mfcc_and_inference();
+ *   }
+ */
+class VoiceActivityDetector
+{
+public:
+	struct Config {
+		/* Analysis frame, in samples (20 ms at 16 kHz) */
+		uint32_t frameLength = 320;
+		/* Consecutive voiced frames needed to become active */
+		uint32_t onsetFrames = 2;
+		/* Frames kept active after the last voiced one */
+		uint32_t hangoverFrames = 25;
+		/* Frame energy over noise floor for a frame to be voiced, in dB */
+		uint32_t snrDb = 9;
+		/* Absolute energy floor, mean square of the samples (100 is about -70 dBFS) */
+		uint32_t minEnergy = 100;
+		/* Zero crossings above this percentage of the frame are noise-like */
+		uint32_t maxZeroCrossingPercent = 25;
+	};
+
+	struct Stats {
+		/* Analysed frames, and the voiced ones */
+		uint32_t frames;
+		uint32_t voicedFrames;
+		/* Blocks given to Process(), and those returning true */
+		uint32_t blocks;
+		uint32_t activeBlocks;
+		/* Inactive to active transitions */
+		uint32_t onsets;
+		/* From the first voiced frame of an onset to the end of the block activating it */
+		uint64_t onsetLatencySum;
+		uint32_t onsetLatencyMax;
+	};
+
+	VoiceActivityDetector() : VoiceActivityDetector(Config())
+	{
+	}
+
+	explicit VoiceActivityDetector(const Config &config)
+		: m_config(config),
+		  m_snrQ8(static_cast<uint64_t>(
+			  lroundf(powf(10.0f, static_cast<float>(config.snrDb) / 10.0f) * 256)))
+	{
+	}
+
+	/**
+	 * @brief Analyse a block of samples, a whole number of frames (a trailing partial frame is
+	 *        ignored).
+	 *
+	 * @return true if voice is active at any frame of the block.
+	 */
+	bool Process(const int16_t *samples, size_t count)
+	{
+		bool blockActive = false;
+
+		for (size_t offset = 0; offset + m_config.frameLength <= count;
+		     offset += m_config.frameLength) {
+			ProcessFrame(samples + offset, m_position + offset);
+			blockActive = blockActive || m_active;
+		}
+
+		m_position += count;
+
+		if (m_onsetPending) {
+			const uint64_t latency = m_position - m_onsetStart;
+
+			m_stats.onsetLatencySum += latency;
+			if (latency > m_stats.onsetLatencyMax) {
+				m_stats.onsetLatencyMax = static_cast<uint32_t>(latency);
+			}
+			m_onsetPending = false;
+		}
+
+		m_stats.blocks++;
+		m_stats.activeBlocks += blockActive ? 1 : 0;
+
+		return blockActive;
+	}
+
+	bool IsActive() const
+	{
+		return m_active;
+	}
+
+	const Stats &GetStats() const
+	{
+		return m_stats;
+	}
+
+	void ResetStats()
+	{
+		m_stats = Stats();
+	}
+
+private:
+	void ProcessFrame(const int16_t *frame, uint64_t position)
+	{
+		const uint32_t length = m_config.frameLength;
+		int64_t sum = 0;
+
+		for (uint32_t i = 0; i < length; i++) {
+			sum += frame[i];
+		}
+
+		const auto mean = static_cast<int32_t>(sum / static_cast<int64_t>(length));
+		uint64_t sumSquares = 0;
+		uint32_t crossings = 0;
+		bool negative = frame[0] < mean;
+
+		for (uint32_t i = 0; i < length; i++) {
+			const int32_t sample = frame[i] - mean;
+
+			sumSquares += static_cast<uint64_t>(static_cast<int64_t>(sample) * sample);
+			if ((sample < 0) != negative) {
+				negative = !negative;
+				crossings++;
+			}
+		}
+
+		const uint64_t energy = sumSquares / length;
+
+		if (!m_floorValid) {
+			m_floor = energy > 0 ? energy : 1;
+			m_floorValid = true;
+		}
+
+		const uint64_t threshold = m_floor * m_snrQ8;
+		const bool loud = energy >= m_config.minEnergy && energy * 256 > threshold;
+		const bool speechLike = crossings * 100 <= m_config.maxZeroCrossingPercent * length ||
+					energy * 256 > 4 * threshold;
+		const bool voiced = loud && speechLike;
+
+		/* Track the noise floor, quickly down, slowly up, very slowly while voiced */
+		if (energy < m_floor) {
+			m_floor -= (m_floor - energy) >> 2;
+		} else {
+			m_floor += (energy - m_floor) >> (voiced ? 10 : 5);
+		}
+		m_floor = m_floor > 0 ? m_floor : 1;
+
+		m_stats.frames++;
+
+		if (!voiced) {
+			m_voicedRun = 0;
+			/* Active for exactly hangoverFrames unvoiced frames */
+			if (m_active) {
+				if (m_hangover == 0) {
+					m_active = false;
+				} else {
+					m_hangover--;
+				}
+			}
+			return;
+		}
+
+		m_stats.voicedFrames++;
+
+		if (m_voicedRun++ == 0) {
+			m_runStart = position;
+		}
+
+		if (!m_active && m_voicedRun >= m_config.onsetFrames) {
+			m_active = true;
+			m_onsetStart = m_runStart;
+			m_onsetPending = true;
+			m_stats.onsets++;
+		}
+
+		if (m_active) {
+			m_hangover = m_config.hangoverFrames;
+		}
+	}
+
+	Config m_config;
+	/* Linear power ratio of snrDb, Q8 */
+	uint64_t m_snrQ8;
+	uint64_t m_floor = 0;
+	bool m_floorValid = false;
+	bool m_active = false;
+	uint32_t m_voicedRun = 0;
+	uint32_t m_hangover = 0;
+	/* Samples processed so far, and the positions of the current voiced run and onset */
+	uint64_t m_position = 0;
+	uint64_t m_runStart = 0;
+	uint64_t m_onsetStart = 0;
+	bool m_onsetPending = false;
+	Stats m_stats = Stats();
+};
+
+#endif /* VOICEACTIVITYDETECTOR_H */
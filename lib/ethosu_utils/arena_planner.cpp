@@ -0,0 +1,194 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "arena_planner.hpp"
+
+#include <tensorflow/lite/micro/arena_allocator/non_persistent_arena_buffer_allocator.h>
+#include <tensorflow/lite/micro/arena_allocator/persistent_arena_buffer_allocator.h>
+#include <tensorflow/lite/micro/arena_allocator/recording_single_arena_buffer_allocator.h>
+#include <tensorflow/lite/micro/micro_allocator.h>
+#include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/micro/recording_micro_allocator.h>
+#include <tensorflow/lite/schema/schema_generated.h>
+
+#include <inttypes.h>
+#include <zephyr/kernel.h>
+
+using namespace std;
+
+namespace
+{
+/* Alignment of every region, matches the tensor arena alignment */
+constexpr size_t regionAlignment = 16;
+
+/* Allocator objects placed at the start of the persistent region, with the
+ * worst case padding to their alignment. The memory planner is allocated there
+ * by both allocators, so it is already in the measured size. */
+template <typename T> constexpr size_t objectSize()
+{
+	return sizeof(T) + alignof(T) - 1;
+}
+
+/* What the split allocator of InferenceProcess keeps in the persistent region */
+constexpr size_t splitAllocatorSize = objectSize<tflite::PersistentArenaBufferAllocator>() +
+				      objectSize<tflite::NonPersistentArenaBufferAllocator>() +
+				      objectSize<tflite::MicroAllocator>();
+
+/* What the recording allocator used for measuring keeps there instead */
+constexpr size_t recordingAllocatorSize =
+	sizeof(tflite::RecordingSingleArenaBufferAllocator) +
+	sizeof(tflite::RecordingMicroAllocator);
+
+/* Bytes the measured persistent size lacks for the split allocator */
+constexpr size_t persistentMargin = splitAllocatorSize > recordingAllocatorSize
+					    ? splitAllocatorSize - recordingAllocatorSize
+					    : 0;
+
+size_t alignUp(size_t size)
+{
+	return (size + regionAlignment - 1) & ~(regionAlignment - 1);
+}
+
+} /* namespace */
+
+namespace InferenceProcess
+{
+ArenaPlanner::ArenaPlanner(uint8_t *_arena, size_t _arenaSize)
+	: arena(_arena), arenaSize(_arenaSize), sharedSize(0), peak(0), planned(false)
+{
+}
+
+bool ArenaPlanner::addModel(const DataPtr &networkModel)
+{
+	if (planned) {
+		printk("Arena already planned. model=%p\n", networkModel.data);
+		return true;
+	}
+
+	entries.push_back({networkModel, 0, 0, 0});
+
+	return false;
+}
+
+bool ArenaPlanner::measure(Entry &entry)
+{
+	const tflite::Model *model = ::tflite::GetModel(entry.networkModel.data);
+	if (model->version() != TFLITE_SCHEMA_VERSION) {
+		printk("Model schema version unsupported: version=%" PRIu32 ", supported=%d.\n",
+		       model->version(), TFLITE_SCHEMA_VERSION);
+		return true;
+	}
+
+	/* Allocate the model once in the whole arena, recording the usage */
+	tflite::RecordingMicroAllocator *allocator =
+		tflite::RecordingMicroAllocator::Create(arena, arenaSize);
+	if (allocator == nullptr) {
+		printk("Failed to create recording allocator. arena=%p\n", arena);
+		return true;
+	}
+
+	unique_ptr<tflite::MicroOpResolver> resolver = createOpResolver();
+	tflite::MicroInterpreter interpreter(model, *resolver, allocator);
+
+	if (interpreter.AllocateTensors() != kTfLiteOk) {
+		printk("Failed to allocate tensors for planning. model=%p\n",
+		       entry.networkModel.data);
+		return true;
+	}
+
+	const auto *memory = allocator->GetSimpleMemoryAllocator();
+	entry.persistentSize = alignUp(memory->GetPersistentUsedBytes() + persistentMargin);
+	entry.nonPersistentSize = alignUp(memory->GetNonPersistentUsedBytes());
+
+	return false;
+}
+
+bool ArenaPlanner::plan()
+{
+	if (entries.empty()) {
+		printk("No models to plan\n");
+		return true;
+	}
+
+	sharedSize = 0;
+
+	for (auto &entry : entries) {
+		if (measure(entry)) {
+			return true;
+		}
+
+		sharedSize = max(sharedSize, entry.nonPersistentSize);
+	}
+
+	/* Persistent regions follow the shared region back to back */
+	size_t offset = sharedSize;
+	for (auto &entry : entries) {
+		entry.persistentOffset = offset;
+		offset += entry.persistentSize;
+	}
+
+	peak = offset;
+
+	if (peak > arenaSize) {
+		printk("Shared arena too small. required=%zu, available=%zu\n", peak, arenaSize);
+		return true;
+	}
+
+	planned = true;
+
+	return false;
+}
+
+bool ArenaPlanner::getLayout(size_t index, ArenaLayout &layout) const
+{
+	if (!planned || index >= entries.size()) {
+		return true;
+	}
+
+	const Entry &entry = entries[index];
+
+	layout.persistentArena = arena + entry.persistentOffset;
+	layout.persistentArenaSize = entry.persistentSize;
+	layout.sharedArena = arena;
+	layout.sharedArenaSize = sharedSize;
+
+	return false;
+}
+
+size_t ArenaPlanner::getPeak() const
+{
+	return peak;
+}
+
+size_t ArenaPlanner::getUnsharedSize() const
+{
+	size_t size = 0;
+
+	for (const auto &entry : entries) {
+		size += entry.persistentSize + entry.nonPersistentSize;
+	}
+
+	return size;
+}
+
+void ArenaPlanner::print() const
+{
+	printk("Arena plan: models=%zu, shared=%zu, peak=%zu, unshared=%zu, arena=%zu\n",
+	       entries.size(), sharedSize, peak, getUnsharedSize(), arenaSize);
+
+	for (size_t i = 0; i < entries.size(); i++) {
+		const Entry &entry = entries[i];
+
+		printk("  model %zu: data=%p, persistent=%zu @ %zu, non-persistent=%zu\n", i,
+		       entry.networkModel.data, entry.persistentSize, entry.persistentOffset,
+		       entry.nonPersistentSize);
+	}
+}
+
+} /* namespace InferenceProcess */
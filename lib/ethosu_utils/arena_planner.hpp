@@ -0,0 +1,76 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include "inference_process.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace InferenceProcess
+{
+struct ArenaLayout {
+	uint8_t *persistentArena;
+	size_t persistentArenaSize;
+	uint8_t *sharedArena;
+	size_t sharedArenaSize;
+};
+
+/*
+ * Plans one tensor arena for a set of models that never execute concurrently.
+ *
+ * Every model keeps a private persistent region (interpreter and kernel state,
+ * variable tensors), while the non-persistent region holding activations and
+ * scratch buffers is shared and sized for the largest model:
+ *
+ *   | shared | persistent 0 | persistent 1 | ... |
+ *
+ * Each model is then run through its own InferenceProcess created from
+ * getLayout(), so switching between models does not plan the arena again.
+ * plan() measures the models in the arena itself and must therefore be called
+ * before any of the resulting InferenceProcess instances opens a session.
+ *
+ * Functions returning bool return true on failure, like runJob().
+ */
+class ArenaPlanner {
+    public:
+	ArenaPlanner(uint8_t *_arena, size_t _arenaSize);
+
+	bool addModel(const DataPtr &networkModel);
+	bool plan();
+
+	bool getLayout(size_t index, ArenaLayout &layout) const;
+
+	/* Arena bytes used by the shared layout */
+	size_t getPeak() const;
+	/* Arena bytes needed if every model had a private arena */
+	size_t getUnsharedSize() const;
+
+	void print() const;
+
+    private:
+	struct Entry {
+		DataPtr networkModel;
+		size_t persistentSize;
+		size_t nonPersistentSize;
+		size_t persistentOffset;
+	};
+
+	bool measure(Entry &entry);
+
+	uint8_t *arena;
+	const size_t arenaSize;
+	std::vector<Entry> entries;
+	size_t sharedSize;
+	size_t peak;
+	bool planned;
+};
+} /* namespace InferenceProcess */
@@ -6,6 +6,7 @@
 
 #include "inference_process.hpp"
 
+#include <tensorflow/lite/micro/micro_allocator.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
 #include <tensorflow/lite/micro/cortex_m_generic/debug_log_callback.h>
 #include <tensorflow/lite/micro/micro_log.h>
@@ -13,8 +14,12 @@
 #include <tensorflow/lite/micro/micro_profiler.h>
 #include <tensorflow/lite/schema/schema_generated.h>
 
+#if defined(CONFIG_CPU_CORTEX_M)
 #include <cmsis_compiler.h>
+#endif
 #include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 
 using namespace std;
@@ -33,7 +38,11 @@ bool copyOutput(const TfLiteTensor &src, InferenceProcess::DataPtr &dst)
 		return true;
 	}
 
-	copy(src.data.uint8, src.data.uint8 + src.bytes, static_cast<uint8_t *>(dst.data));
+	/* Output bound to the arena tensor storage, nothing to copy */
+	if (dst.data != src.data.data) {
+		copy(src.data.uint8, src.data.uint8 + src.bytes, static_cast<uint8_t *>(dst.data));
+	}
+
 	dst.size = src.bytes;
 
 	return false;
@@ -61,7 +70,7 @@ void DataPtr::clean()
 #endif
 }
 
-InferenceJob::InferenceJob()
+InferenceJob::InferenceJob() : expectedOutputTolerance(0)
 {
 }
 
@@ -69,7 +78,7 @@ InferenceJob::InferenceJob(const string &_name, const DataPtr &_networkModel,
 			   const vector<DataPtr> &_input, const vector<DataPtr> &_output,
 			   const vector<DataPtr> &_expectedOutput)
 	: name(_name), networkModel(_networkModel), input(_input), output(_output),
-	  expectedOutput(_expectedOutput)
+	  expectedOutput(_expectedOutput), expectedOutputTolerance(0)
 {
 }
 
@@ -107,10 +116,30 @@ void InferenceJob::clean()
 	}
 }
 
-bool InferenceProcess::runJob(InferenceJob &job)
+InferenceProcess::InferenceProcess(uint8_t *_tensorArena, size_t _tensorArenaSize)
+	: tensorArena(_tensorArena), tensorArenaSize(_tensorArenaSize), sharedArena(nullptr),
+	  sharedArenaSize(0), profiler(nullptr)
+{
+}
+
+InferenceProcess::InferenceProcess(uint8_t *_tensorArena, size_t _tensorArenaSize,
+				   uint8_t *_sharedArena, size_t _sharedArenaSize)
+	: tensorArena(_tensorArena), tensorArenaSize(_tensorArenaSize), sharedArena(_sharedArena),
+	  sharedArenaSize(_sharedArenaSize), profiler(nullptr)
 {
+}
+
+InferenceProcess::~InferenceProcess()
+{
+	closeSession();
+}
+
+bool InferenceProcess::openSession(const DataPtr &networkModel)
+{
+	closeSession();
+
 	/* Get model handle and verify that the version is correct */
-	const tflite::Model *model = ::tflite::GetModel(job.networkModel.data);
+	const tflite::Model *model = ::tflite::GetModel(networkModel.data);
 	if (model->version() != TFLITE_SCHEMA_VERSION) {
 		printk("Model schema version unsupported: version=%" PRIu32 ", supported=%d.\n",
 		       model->version(), TFLITE_SCHEMA_VERSION);
@@ -118,18 +147,92 @@ bool InferenceProcess::runJob(InferenceJob &job)
 	}
 
 	/* Create the TFL micro interpreter */
-	tflite::MicroMutableOpResolver <1> resolver;
-	resolver.AddEthosU();
+	opResolver = createOpResolver();
+
+	if (sharedArena != nullptr) {
+		/* Persistent data in the private arena, activations in the shared one */
+		tflite::MicroAllocator *allocator = tflite::MicroAllocator::Create(
+			tensorArena, tensorArenaSize, sharedArena, sharedArenaSize);
+		if (allocator == nullptr) {
+			printk("Failed to create allocator. arena=%p, shared=%p\n", tensorArena,
+			       sharedArena);
+			closeSession();
+			return true;
+		}
 
-	tflite::MicroInterpreter interpreter(model, resolver, tensorArena, tensorArenaSize);
+		sessionInterpreter = make_unique<tflite::MicroInterpreter>(
+			model, *opResolver, allocator, nullptr, profiler);
+	} else {
+		sessionInterpreter = make_unique<tflite::MicroInterpreter>(
+			model, *opResolver, tensorArena, tensorArenaSize, nullptr, profiler);
+	}
 
 	/* Allocate tensors */
-	TfLiteStatus allocate_status = interpreter.AllocateTensors();
+	TfLiteStatus allocate_status = sessionInterpreter->AllocateTensors();
 	if (allocate_status != kTfLiteOk) {
-		printk("Failed to allocate tensors for inference. job=%p\n", &job);
+		printk("Failed to allocate tensors for inference. model=%p\n", networkModel.data);
+		closeSession();
 		return true;
 	}
 
+	sessionModel = networkModel;
+
+	return false;
+}
+
+void InferenceProcess::closeSession()
+{
+	sessionInterpreter.reset();
+	opResolver.reset();
+	sessionModel = DataPtr();
+}
+
+bool InferenceProcess::hasSession(const DataPtr &networkModel) const
+{
+	return sessionInterpreter != nullptr && sessionModel.data == networkModel.data &&
+	       sessionModel.size == networkModel.size;
+}
+
+void InferenceProcess::setProfiler(tflite::MicroProfilerInterface *_profiler)
+{
+	if (profiler != _profiler) {
+		closeSession();
+		profiler = _profiler;
+	}
+}
+
+DataPtr InferenceProcess::inputBuffer(size_t index) const
+{
+	if (sessionInterpreter == nullptr || index >= sessionInterpreter->inputs_size()) {
+		return DataPtr();
+	}
+
+	TfLiteTensor *tensor = sessionInterpreter->input(index);
+
+	return DataPtr(tensor->data.data, tensor->bytes);
+}
+
+DataPtr InferenceProcess::outputBuffer(size_t index) const
+{
+	if (sessionInterpreter == nullptr || index >= sessionInterpreter->outputs_size()) {
+		return DataPtr();
+	}
+
+	TfLiteTensor *tensor = sessionInterpreter->output(index);
+
+	return DataPtr(tensor->data.data, tensor->bytes);
+}
+
+bool InferenceProcess::runJob(InferenceJob &job)
+{
+	/* Reuse the interpreter as long as the job references the session model */
+	if (!hasSession(job.networkModel) && openSession(job.networkModel)) {
+		printk("Failed to open session. job=%s\n", job.name.c_str());
+		return true;
+	}
+
+	tflite::MicroInterpreter &interpreter = *sessionInterpreter;
+
 	if (job.input.size() != interpreter.inputs_size()) {
 		printk("Number of job and network inputs do not match. input=%zu, network=%zu\n",
 		       job.input.size(), interpreter.inputs_size());
@@ -147,6 +250,11 @@ bool InferenceProcess::runJob(InferenceJob &job)
 			return true;
 		}
 
+		/* Input filled in place through inputBuffer(), nothing to copy */
+		if (input.data == tensor->data.data) {
+			continue;
+		}
+
 		copy(static_cast<char *>(input.data), static_cast<char *>(input.data) + input.size,
 		     tensor->data.uint8);
 	}
@@ -190,12 +298,20 @@ bool InferenceProcess::runJob(InferenceJob &job)
 				return true;
 			}
 
+			/* Only walk the tensor element by element on mismatch */
+			if (memcmp(output->data.data, expected.data, output->bytes) == 0) {
+				continue;
+			}
+
 			for (unsigned int j = 0; j < output->bytes; ++j) {
-				if (output->data.uint8[j] !=
-				    static_cast<uint8_t *>(expected.data)[j]) {
-					printk("Expected output tensor data mismatch. index=%u, offset=%u, expected=%02x, network=%02x\n",
-					       i, j, static_cast<uint8_t *>(expected.data)[j],
-					       output->data.uint8[j]);
+				int8_t expectedVal = static_cast<int8_t *>(expected.data)[j];
+				int8_t actualVal = output->data.int8[j];
+
+				if (abs(actualVal - expectedVal) > job.expectedOutputTolerance) {
+					printk("Expected output tensor data mismatch. index=%u, offset=%u, expected=%02x, network=%02x, tolerance=%d\n",
+					       i, j, static_cast<uint8_t>(expectedVal),
+					       static_cast<uint8_t>(actualVal),
+					       job.expectedOutputTolerance);
 					return true;
 				}
 			}
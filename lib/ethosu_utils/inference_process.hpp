@@ -7,11 +7,19 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <queue>
 #include <stdlib.h>
 #include <string>
 #include <vector>
 
+namespace tflite
+{
+class MicroInterpreter;
+class MicroOpResolver;
+class MicroProfilerInterface;
+} /* namespace tflite */
+
 namespace InferenceProcess
 {
 struct DataPtr {
@@ -30,6 +38,8 @@ struct InferenceJob {
 	std::vector<DataPtr> input;
 	std::vector<DataPtr> output;
 	std::vector<DataPtr> expectedOutput;
+	/* Maximum absolute difference per int8 element of expectedOutput */
+	int expectedOutputTolerance;
 
 	InferenceJob();
 	InferenceJob(const std::string &name, const DataPtr &networkModel,
@@ -40,17 +50,66 @@ struct InferenceJob {
 	void clean();
 };
 
+/* Op resolver used by InferenceProcess. Either the default one registering the
+ * Ethos-U operator only, or one generated from the application models, see
+ * ETHOSU_OP_RESOLVER_MODELS in CMakeLists.txt. */
+std::unique_ptr<tflite::MicroOpResolver> createOpResolver();
+
+/*
+ * Runs inference jobs on a single tensor arena.
+ *
+ * The model is parsed and the tensor arena planned once per session. A session
+ * is opened implicitly by runJob() or explicitly by openSession(), and stays
+ * valid for as long as jobs keep referencing the same model. Submitting a job
+ * with a different model pointer (or size) closes the current session and
+ * opens a new one.
+ *
+ * inputBuffer()/outputBuffer() return the arena storage of the session
+ * tensors. Callers may fill inputs in place and reference that storage in the
+ * job, in which case runJob() skips the copy. The same applies to outputs.
+ * Input storage may be reused for intermediate tensors during inference, so
+ * in-place inputs have to be refilled before every job.
+ * If the storage is written or read by another bus master (DMA, camera, ...),
+ * the caller is responsible for the DataPtr::clean()/invalidate() calls.
+ *
+ * The second constructor splits the arena in a private persistent region and
+ * a non-persistent region that may be shared with other InferenceProcess
+ * instances, see ArenaPlanner. Instances sharing a region must never run
+ * jobs concurrently.
+ */
 class InferenceProcess {
     public:
-	InferenceProcess(uint8_t *_tensorArena, size_t _tensorArenaSize)
-		: tensorArena(_tensorArena), tensorArenaSize(_tensorArenaSize)
-	{
-	}
+	InferenceProcess(uint8_t *_tensorArena, size_t _tensorArenaSize);
+	InferenceProcess(uint8_t *_tensorArena, size_t _tensorArenaSize, uint8_t *_sharedArena,
+			 size_t _sharedArenaSize);
+	~InferenceProcess();
+
+	InferenceProcess(const InferenceProcess &) = delete;
+	InferenceProcess &operator=(const InferenceProcess &) = delete;
 
 	bool runJob(InferenceJob &job);
 
+	/* Parse the model and allocate tensors. Returns true on failure. */
+	bool openSession(const DataPtr &networkModel);
+	void closeSession();
+	bool hasSession(const DataPtr &networkModel) const;
+
+	/* Arena storage of session tensors. Empty if no session or bad index. */
+	DataPtr inputBuffer(size_t index) const;
+	DataPtr outputBuffer(size_t index) const;
+
+	/* Profiler passed to the interpreter. Changing it closes the session. */
+	void setProfiler(tflite::MicroProfilerInterface *_profiler);
+
     private:
 	uint8_t *tensorArena;
 	const size_t tensorArenaSize;
+	uint8_t *sharedArena;
+	const size_t sharedArenaSize;
+	tflite::MicroProfilerInterface *profiler;
+
+	DataPtr sessionModel;
+	std::unique_ptr<tflite::MicroOpResolver> opResolver;
+	std::unique_ptr<tflite::MicroInterpreter> sessionInterpreter;
 };
 } /* namespace InferenceProcess */
@@ -0,0 +1,165 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "inference_service.hpp"
+
+namespace InferenceProcess
+{
+InferenceRequest::InferenceRequest(InferenceJob *_job, int _priority,
+				   struct k_poll_signal *_signal, InferenceCallback _callback,
+				   void *_userData)
+	: job(_job), priority(_priority), signal(_signal), callback(_callback),
+	  userData(_userData), status(false), node{}
+{
+}
+
+InferenceService::InferenceService(uint8_t *_tensorArena, size_t _tensorArenaSize)
+	: process(_tensorArena, _tensorArenaSize), lock{}, pendingCount(0), started(false)
+{
+	k_sem_init(&pending, 0, K_SEM_MAX_LIMIT);
+	sys_dlist_init(&queue);
+}
+
+void InferenceService::start(k_thread_stack_t *stack, size_t stackSize, int threadPriority)
+{
+	if (started) {
+		return;
+	}
+
+	started = true;
+
+	k_thread_create(&thread, stack, stackSize, serviceEntry, this, NULL, NULL,
+			threadPriority, 0, K_NO_WAIT);
+	k_thread_name_set(&thread, "inference_service");
+}
+
+bool InferenceService::submit(InferenceRequest &request)
+{
+	if (request.job == nullptr) {
+		printk("Inference request without job\n");
+		return true;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (sys_dnode_is_linked(&request.node)) {
+		k_spin_unlock(&lock, key);
+		printk("Inference request already queued. job=%s\n", request.job->name.c_str());
+		return true;
+	}
+
+	request.status = false;
+
+	/* Insert after the last request with the same or a higher priority */
+	InferenceRequest *next = nullptr;
+	InferenceRequest *it;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&queue, it, node) {
+		if (it->priority > request.priority) {
+			next = it;
+			break;
+		}
+	}
+
+	if (next != nullptr) {
+		sys_dlist_insert(&next->node, &request.node);
+	} else {
+		sys_dlist_append(&queue, &request.node);
+	}
+
+	pendingCount++;
+
+	k_spin_unlock(&lock, key);
+
+	k_sem_give(&pending);
+
+	return false;
+}
+
+bool InferenceService::cancel(InferenceRequest &request)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (!sys_dnode_is_linked(&request.node)) {
+		k_spin_unlock(&lock, key);
+		return true;
+	}
+
+	/* The semaphore count is left as is, the service thread skips empty wake ups */
+	sys_dlist_remove(&request.node);
+	pendingCount--;
+
+	k_spin_unlock(&lock, key);
+
+	return false;
+}
+
+size_t InferenceService::getPendingCount()
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	size_t count = pendingCount;
+
+	k_spin_unlock(&lock, key);
+
+	return count;
+}
+
+InferenceProcess &InferenceService::getProcess()
+{
+	return process;
+}
+
+void InferenceService::serviceEntry(void *ctx, void *, void *)
+{
+	static_cast<InferenceService *>(ctx)->run();
+}
+
+InferenceRequest *InferenceService::takeNext()
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	sys_dnode_t *node = sys_dlist_get(&queue);
+
+	if (node != nullptr) {
+		pendingCount--;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return node != nullptr ? CONTAINER_OF(node, InferenceRequest, node) : nullptr;
+}
+
+void InferenceService::run()
+{
+	for (;;) {
+		k_sem_take(&pending, K_FOREVER);
+
+		InferenceRequest *request = takeNext();
+		if (request == nullptr) {
+			continue;
+		}
+
+		request->status = process.runJob(*request->job);
+
+		/* The request may be reused or go out of scope once completion is signalled */
+		InferenceCallback callback = request->callback;
+		void *userData = request->userData;
+		struct k_poll_signal *signal = request->signal;
+		const bool status = request->status;
+
+		if (callback != nullptr) {
+			callback(*request, userData);
+		}
+
+		if (signal != nullptr) {
+			k_poll_signal_raise(signal, status);
+		}
+	}
+}
+
+} /* namespace InferenceProcess */
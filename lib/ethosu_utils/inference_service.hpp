@@ -0,0 +1,95 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include "inference_process.hpp"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+
+namespace InferenceProcess
+{
+struct InferenceRequest;
+
+/* Completion callback, called from the service thread */
+typedef void (*InferenceCallback)(InferenceRequest &request, void *userData);
+
+/*
+ * Inference job queued to an InferenceService.
+ *
+ * Lower priority values run first, as for Zephyr threads. Requests with the
+ * same priority run in submission order. On completion status holds the
+ * runJob() result (true on failure), then signal is raised with that status
+ * and callback is called. Both are optional.
+ *
+ * The request and its job must stay valid until completion or a successful
+ * cancel().
+ */
+struct InferenceRequest {
+	InferenceJob *job;
+	int priority;
+	struct k_poll_signal *signal;
+	InferenceCallback callback;
+	void *userData;
+	bool status;
+
+	InferenceRequest(InferenceJob *job = nullptr, int priority = 0,
+			 struct k_poll_signal *signal = nullptr,
+			 InferenceCallback callback = nullptr, void *userData = nullptr);
+
+	/* Owned by InferenceService while queued */
+	sys_dnode_t node;
+};
+
+/*
+ * Single NPU service thread shared by any number of producers.
+ *
+ * submit() queues a request and returns immediately. The service thread runs
+ * the queued requests one at a time on its InferenceProcess, highest priority
+ * first. A running inference is never interrupted, but a high priority request
+ * (e.g. wake word) overtakes every lower priority request still queued.
+ *
+ * Producers wait for completion with k_poll() on the request signal, or get
+ * the callback. Only the service thread needs a stack large enough for TFLM.
+ */
+class InferenceService {
+    public:
+	InferenceService(uint8_t *_tensorArena, size_t _tensorArenaSize);
+
+	InferenceService(const InferenceService &) = delete;
+	InferenceService &operator=(const InferenceService &) = delete;
+
+	/* Start the service thread on the given stack */
+	void start(k_thread_stack_t *stack, size_t stackSize, int threadPriority);
+
+	/* Queue a request. Returns true on failure. */
+	bool submit(InferenceRequest &request);
+	/* Remove a request not started yet. Returns true if it was not queued. */
+	bool cancel(InferenceRequest &request);
+
+	size_t getPendingCount();
+
+	/* Process used by the service thread, only touch it while idle */
+	InferenceProcess &getProcess();
+
+    private:
+	static void serviceEntry(void *ctx, void *, void *);
+	void run();
+	InferenceRequest *takeNext();
+
+	InferenceProcess process;
+	struct k_thread thread;
+	struct k_spinlock lock;
+	struct k_sem pending;
+	sys_dlist_t queue;
+	size_t pendingCount;
+	bool started;
+};
+} /* namespace InferenceProcess */
@@ -0,0 +1,195 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "layer_profiler.hpp"
+
+#include <ethosu_driver.h>
+#include <pmu_ethosu.h>
+
+#include <inttypes.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+
+using namespace std;
+
+namespace
+{
+constexpr size_t maxEvents = CONFIG_ALIF_ETHOSU_PROFILER_MAX_EVENTS;
+constexpr size_t noEvent = SIZE_MAX;
+
+/* Name of the TFLM custom operator running a Vela compiled NPU segment */
+constexpr const char *ethosuOpName = "ethos-u";
+
+const enum ethosu_pmu_event_type pmuEvents[InferenceProcess::LayerProfiler::numPmuCounters] = {
+	ETHOSU_PMU_NPU_ACTIVE,
+	ETHOSU_PMU_NPU_IDLE,
+};
+
+const char *const pmuEventNames[InferenceProcess::LayerProfiler::numPmuCounters] = {
+	"npu_active",
+	"npu_idle",
+};
+
+/* Profiler of the operator being invoked, used by the NPU driver hooks */
+InferenceProcess::LayerProfiler *activeProfiler;
+
+} /* namespace */
+
+namespace InferenceProcess
+{
+LayerProfiler::LayerProfiler() : eventCount(0), droppedCount(0), openEvent(noEvent)
+{
+}
+
+uint32_t LayerProfiler::BeginEvent(const char *tag)
+{
+	if (eventCount >= maxEvents) {
+		droppedCount++;
+		return maxEvents;
+	}
+
+	const size_t index = eventCount++;
+	Event &event = events[index];
+
+	event = {};
+	event.tag = tag;
+	event.npu = strcmp(tag, ethosuOpName) == 0;
+
+	openEvent = index;
+	activeProfiler = this;
+	startCycles[index] = k_cycle_get_32();
+
+	return index;
+}
+
+void LayerProfiler::EndEvent(uint32_t eventHandle)
+{
+	const uint32_t end = k_cycle_get_32();
+
+	if (eventHandle >= eventCount) {
+		return;
+	}
+
+	events[eventHandle].cpuCycles = end - startCycles[eventHandle];
+
+	openEvent = noEvent;
+	activeProfiler = nullptr;
+}
+
+void LayerProfiler::reset()
+{
+	eventCount = 0;
+	droppedCount = 0;
+	openEvent = noEvent;
+}
+
+size_t LayerProfiler::getEventCount() const
+{
+	return eventCount;
+}
+
+const LayerProfiler::Event &LayerProfiler::getEvent(size_t index) const
+{
+	return events[index];
+}
+
+size_t LayerProfiler::getDroppedCount() const
+{
+	return droppedCount;
+}
+
+void LayerProfiler::npuBegin(struct ethosu_driver *drv)
+{
+	ETHOSU_PMU_Enable(drv);
+
+	for (size_t i = 0; i < numPmuCounters; i++) {
+		ETHOSU_PMU_Set_EVTYPER(drv, i, pmuEvents[i]);
+		ETHOSU_PMU_CNTR_Enable(drv, 1 << i);
+	}
+
+	ETHOSU_PMU_CNTR_Enable(drv, ETHOSU_PMU_CCNT_Msk);
+	ETHOSU_PMU_CYCCNT_Reset(drv);
+	ETHOSU_PMU_EVCNTR_ALL_Reset(drv);
+}
+
+void LayerProfiler::npuEnd(struct ethosu_driver *drv)
+{
+	if (openEvent != noEvent) {
+		Event &event = events[openEvent];
+
+		/* A custom operator may run several command streams, accumulate */
+		event.npuCycles += ETHOSU_PMU_Get_CCNTR(drv);
+
+		for (size_t i = 0; i < numPmuCounters; i++) {
+			event.pmuCounters[i] += ETHOSU_PMU_Get_EVCNTR(drv, i);
+		}
+	}
+
+	ETHOSU_PMU_Disable(drv);
+}
+
+void LayerProfiler::print() const
+{
+	uint64_t cpuTotal = 0;
+	uint64_t npuOpTotal = 0;
+	size_t cpuOps = 0;
+
+	printk("%-4s %-24s %-4s %12s %12s %12s %12s\n", "idx", "operator", "tgt", "cpu_cycles",
+	       "npu_cycles", pmuEventNames[0], pmuEventNames[1]);
+
+	for (size_t i = 0; i < eventCount; i++) {
+		const Event &event = events[i];
+
+		printk("%-4zu %-24s %-4s %12" PRIu32 " %12" PRIu64 " %12" PRIu32 " %12" PRIu32 "\n",
+		       i, event.tag, event.npu ? "NPU" : "CPU", event.cpuCycles, event.npuCycles,
+		       event.pmuCounters[0], event.pmuCounters[1]);
+
+		if (event.npu) {
+			npuOpTotal += event.cpuCycles;
+		} else {
+			cpuTotal += event.cpuCycles;
+			cpuOps++;
+		}
+	}
+
+	printk("Total: ops=%zu, cpu_ops=%zu, cpu_op_cycles=%" PRIu64 ", npu_op_cycles=%" PRIu64
+	       ", dropped=%zu\n",
+	       eventCount, cpuOps, cpuTotal, npuOpTotal, droppedCount);
+}
+
+void LayerProfiler::printCsv() const
+{
+	printk("index,operator,target,cpu_cycles,npu_cycles,%s,%s\n", pmuEventNames[0],
+	       pmuEventNames[1]);
+
+	for (size_t i = 0; i < eventCount; i++) {
+		const Event &event = events[i];
+
+		printk("%zu,%s,%s,%" PRIu32 ",%" PRIu64 ",%" PRIu32 ",%" PRIu32 "\n", i, event.tag,
+		       event.npu ? "NPU" : "CPU", event.cpuCycles, event.npuCycles,
+		       event.pmuCounters[0], event.pmuCounters[1]);
+	}
+}
+
+} /* namespace InferenceProcess */
+
+/* Ethos-U driver hooks, weak in the driver */
+extern "C" void ethosu_inference_begin(struct ethosu_driver *drv, void *)
+{
+	if (activeProfiler != nullptr) {
+		activeProfiler->npuBegin(drv);
+	}
+}
+
+extern "C" void ethosu_inference_end(struct ethosu_driver *drv, void *)
+{
+	if (activeProfiler != nullptr) {
+		activeProfiler->npuEnd(drv);
+	}
+}
@@ -0,0 +1,71 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include <tensorflow/lite/micro/micro_profiler_interface.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct ethosu_driver;
+
+namespace InferenceProcess
+{
+/*
+ * Per-operator profiler for TFLM inferences.
+ *
+ * Records the CPU cycles spent in every operator invoked by the interpreter
+ * and tags operators offloaded to the NPU (the "ethos-u" custom operator)
+ * apart from operators that fell back to the CPU. For NPU operators the
+ * Ethos-U PMU cycle counter and the NPU active/idle event counters are
+ * collected through the driver ethosu_inference_begin()/end() hooks.
+ *
+ * Pass the profiler to the interpreter (see InferenceProcess::setProfiler()),
+ * call reset() before an inference and print()/printCsv() after it.
+ */
+class LayerProfiler : public tflite::MicroProfilerInterface {
+    public:
+	static constexpr size_t numPmuCounters = 2;
+
+	struct Event {
+		const char *tag;
+		bool npu;
+		uint32_t cpuCycles;
+		uint64_t npuCycles;
+		uint32_t pmuCounters[numPmuCounters];
+	};
+
+	LayerProfiler();
+
+	uint32_t BeginEvent(const char *tag) override;
+	void EndEvent(uint32_t eventHandle) override;
+
+	void reset();
+
+	size_t getEventCount() const;
+	const Event &getEvent(size_t index) const;
+	/* Events not recorded since the last reset because the table was full */
+	size_t getDroppedCount() const;
+
+	void print() const;
+	void printCsv() const;
+
+	/* Called from the Ethos-U driver hooks */
+	void npuBegin(struct ethosu_driver *drv);
+	void npuEnd(struct ethosu_driver *drv);
+
+    private:
+	Event events[CONFIG_ALIF_ETHOSU_PROFILER_MAX_EVENTS];
+	uint32_t startCycles[CONFIG_ALIF_ETHOSU_PROFILER_MAX_EVENTS];
+	size_t eventCount;
+	size_t droppedCount;
+	size_t openEvent;
+};
+} /* namespace InferenceProcess */
@@ -0,0 +1,100 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "model_placement.hpp"
+
+#include <string.h>
+#include <zephyr/kernel.h>
+
+namespace
+{
+/* Flatbuffers and NPU tensor data require 16 byte alignment */
+constexpr uintptr_t modelAlignment = 16;
+
+} /* namespace */
+
+namespace InferenceProcess
+{
+const char *placementName(ModelPlacement placement)
+{
+	switch (placement) {
+	case ModelPlacement::InPlace:
+		return "in-place";
+	case ModelPlacement::Sram:
+		return "sram";
+	case ModelPlacement::SramIfFits:
+		return "sram-if-fits";
+	}
+
+	return "unknown";
+}
+
+ModelPool::ModelPool(uint8_t *_pool, size_t _poolSize) : pool(_pool), poolSize(_poolSize), used(0)
+{
+}
+
+bool ModelPool::place(const DataPtr &networkModel, ModelPlacement placement, DataPtr &placed)
+{
+	placed = networkModel;
+
+	if (placement == ModelPlacement::InPlace || contains(networkModel.data)) {
+		return false;
+	}
+
+	const uintptr_t base = reinterpret_cast<uintptr_t>(pool);
+	const uintptr_t start = (base + used + modelAlignment - 1) & ~(modelAlignment - 1);
+	const size_t offset = start - base;
+
+	if (offset > poolSize || networkModel.size > poolSize - offset) {
+		if (placement == ModelPlacement::SramIfFits) {
+			return false;
+		}
+
+		printk("Model does not fit in SRAM pool. model=%p, size=%zu, free=%zu\n",
+		       networkModel.data, networkModel.size, getFree());
+		return true;
+	}
+
+	memcpy(pool + offset, networkModel.data, networkModel.size);
+	used = offset + networkModel.size;
+
+	placed = DataPtr(pool + offset, networkModel.size);
+
+	/* The NPU reads the copy through its own AXI ports */
+	placed.clean();
+
+	return false;
+}
+
+void ModelPool::reset()
+{
+	used = 0;
+}
+
+bool ModelPool::contains(const void *data) const
+{
+	const uint8_t *ptr = static_cast<const uint8_t *>(data);
+
+	return ptr >= pool && ptr < pool + poolSize;
+}
+
+size_t ModelPool::getUsed() const
+{
+	return used;
+}
+
+size_t ModelPool::getFree() const
+{
+	const uintptr_t base = reinterpret_cast<uintptr_t>(pool);
+	const size_t offset = ((base + used + modelAlignment - 1) & ~(modelAlignment - 1)) - base;
+
+	return offset < poolSize ? poolSize - offset : 0;
+}
+
+} /* namespace InferenceProcess */
@@ -0,0 +1,61 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include "inference_process.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace InferenceProcess
+{
+/* Where the weights and command streams of a model are read from */
+enum class ModelPlacement {
+	/* Leave the model where it was linked (MRAM, XIP flash, ...) */
+	InPlace,
+	/* Copy the model to the SRAM pool, fail if it does not fit */
+	Sram,
+	/* Copy the model to the SRAM pool if it fits, else leave it in place */
+	SramIfFits,
+};
+
+const char *placementName(ModelPlacement placement);
+
+/*
+ * SRAM pool models are copied to at load time.
+ *
+ * A TFLite flatbuffer only holds offsets, and Vela places the NPU weights and
+ * command streams in its buffers, so the whole model can be copied as is and
+ * the copy passed to InferenceJob::networkModel. The NPU then fetches weights
+ * from SRAM instead of going through slow memory on every inference.
+ *
+ * The pool is a plain bump allocator: models stay placed until reset(), which
+ * must only be called once no session references a placed model anymore.
+ * The application decides which memory backs the pool, through the section
+ * of the buffer passed to the constructor.
+ */
+class ModelPool {
+    public:
+	ModelPool(uint8_t *_pool, size_t _poolSize);
+
+	/* Place the model according to the policy. Returns true on failure. */
+	bool place(const DataPtr &networkModel, ModelPlacement placement, DataPtr &placed);
+	void reset();
+
+	bool contains(const void *data) const;
+	size_t getUsed() const;
+	size_t getFree() const;
+
+    private:
+	uint8_t *pool;
+	const size_t poolSize;
+	size_t used;
+};
+} /* namespace InferenceProcess */
@@ -0,0 +1,26 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "inference_process.hpp"
+
+#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+
+namespace InferenceProcess
+{
+/* Default resolver for models fully compiled by Vela. Applications running
+ * operators on the CPU set ETHOSU_OP_RESOLVER_MODELS to generate their own. */
+std::unique_ptr<tflite::MicroOpResolver> createOpResolver()
+{
+	auto resolver = std::make_unique<tflite::MicroMutableOpResolver<1>>();
+	resolver->AddEthosU();
+
+	return resolver;
+}
+
+} /* namespace InferenceProcess */
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+# Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+# Use, distribution and modification of this code is permitted under the
+# terms stated in the Alif Semiconductor Software License Agreement
+#
+# You should have received a copy of the Alif Semiconductor Software
+# License Agreement with this file. If not, please write to:
+# contact@alifsemi.com, or visit: https://alifsemi.com/license
+
+"""Generate a TFLM op resolver registering exactly the operators of the given models.
+
+Models are read either as .tflite flatbuffers or as C/C++ sources or headers holding the
+flatbuffer as a byte array. The output defines InferenceProcess::createOpResolver().
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+# TFLite schema BuiltinOperator enum, values the TFLM op resolver can register
+BUILTIN_OPERATORS = {
+    0: "ADD", 1: "AVERAGE_POOL_2D", 2: "CONCATENATION", 3: "CONV_2D",
+    4: "DEPTHWISE_CONV_2D", 5: "DEPTH_TO_SPACE", 6: "DEQUANTIZE", 7: "EMBEDDING_LOOKUP",
+    8: "FLOOR", 9: "FULLY_CONNECTED", 11: "L2_NORMALIZATION", 12: "L2_POOL_2D",
+    14: "LOGISTIC", 17: "MAX_POOL_2D", 18: "MUL", 19: "RELU", 21: "RELU6", 22: "RESHAPE",
+    23: "RESIZE_BILINEAR", 25: "SOFTMAX", 26: "SPACE_TO_DEPTH", 27: "SVDF", 28: "TANH",
+    34: "PAD", 36: "GATHER", 37: "BATCH_TO_SPACE_ND", 38: "SPACE_TO_BATCH_ND",
+    39: "TRANSPOSE", 40: "MEAN", 41: "SUB", 42: "DIV", 43: "SQUEEZE",
+    44: "UNIDIRECTIONAL_SEQUENCE_LSTM", 45: "STRIDED_SLICE", 47: "EXP", 49: "SPLIT",
+    50: "LOG_SOFTMAX", 53: "CAST", 54: "PRELU", 55: "MAXIMUM", 56: "ARG_MAX", 57: "MINIMUM",
+    58: "LESS", 59: "NEG", 60: "PADV2", 61: "GREATER", 62: "GREATER_EQUAL", 63: "LESS_EQUAL",
+    65: "SLICE", 66: "SIN", 67: "TRANSPOSE_CONV", 69: "TILE", 70: "EXPAND_DIMS",
+    71: "EQUAL", 72: "NOT_EQUAL", 73: "LOG", 74: "SUM", 75: "SQRT", 76: "RSQRT", 77: "SHAPE",
+    79: "ARG_MIN", 82: "REDUCE_MAX", 83: "PACK", 84: "LOGICAL_OR", 86: "LOGICAL_AND",
+    87: "LOGICAL_NOT", 88: "UNPACK", 89: "REDUCE_MIN", 90: "FLOOR_DIV", 92: "SQUARE",
+    93: "ZEROS_LIKE", 94: "FILL", 95: "FLOOR_MOD", 97: "RESIZE_NEAREST_NEIGHBOR",
+    98: "LEAKY_RELU", 99: "SQUARED_DIFFERENCE", 100: "MIRROR_PAD", 101: "ABS", 102: "SPLIT_V",
+    104: "CEIL", 106: "ADD_N", 107: "GATHER_ND", 108: "COS", 111: "ELU", 114: "QUANTIZE",
+    116: "ROUND", 117: "HARD_SWISH", 118: "IF", 119: "WHILE", 123: "SELECT_V2",
+    126: "BATCH_MATMUL", 128: "CUMSUM", 129: "CALL_ONCE", 130: "BROADCAST_TO",
+    142: "VAR_HANDLE", 143: "READ_VARIABLE", 144: "ASSIGN_VARIABLE", 145: "BROADCAST_ARGS",
+}
+
+CUSTOM_OPERATORS = {
+    "ethos-u": "AddEthosU",
+}
+
+# Name fragments not following the plain capitalisation of MicroMutableOpResolver methods
+WORD_OVERRIDES = {
+    "2D": "2D", "CUMSUM": "CumSum", "LSTM": "LSTM", "MATMUL": "MatMul", "PADV2": "PadV2",
+    "RELU6": "Relu6", "V2": "V2",
+}
+
+
+def method_name(builtin):
+    words = [WORD_OVERRIDES.get(w, w.capitalize()) for w in builtin.split("_")]
+    return "Add" + "".join(words)
+
+
+def read_model(path, array):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if path.endswith(".tflite"):
+        return data
+
+    text = data.decode("utf-8", errors="replace")
+    name = re.escape(array) if array else r"\w+"
+    for match in re.finditer(name + r"\s*\[\s*\w*\s*\][^={;]*=\s*\{(.*?)\}\s*;", text, re.S):
+        values = re.findall(r"0[xX][0-9a-fA-F]+|\d+", match.group(1))
+        buf = bytes(int(v, 0) for v in values)
+        # Flatbuffer file identifier of TFLite models
+        if buf[4:8] == b"TFL3":
+            return buf
+
+    sys.exit(f"{path}: no TFLite flatbuffer array found")
+
+
+class Table:
+    """Minimal flatbuffer table reader."""
+
+    def __init__(self, buf, pos):
+        self.buf = buf
+        self.pos = pos
+        self.vtable = pos - struct.unpack_from("<i", buf, pos)[0]
+        self.vtable_size = struct.unpack_from("<H", buf, self.vtable)[0]
+
+    def _field(self, index):
+        offset = 4 + 2 * index
+        if offset >= self.vtable_size:
+            return None
+        field = struct.unpack_from("<H", self.buf, self.vtable + offset)[0]
+        return self.pos + field if field else None
+
+    def scalar(self, index, fmt, default=0):
+        pos = self._field(index)
+        return struct.unpack_from(fmt, self.buf, pos)[0] if pos is not None else default
+
+    def _indirect(self, index):
+        pos = self._field(index)
+        if pos is None:
+            return None
+        return pos + struct.unpack_from("<I", self.buf, pos)[0]
+
+    def string(self, index):
+        pos = self._indirect(index)
+        if pos is None:
+            return None
+        length = struct.unpack_from("<I", self.buf, pos)[0]
+        return self.buf[pos + 4:pos + 4 + length].decode("utf-8")
+
+    def tables(self, index):
+        pos = self._indirect(index)
+        if pos is None:
+            return []
+        count = struct.unpack_from("<I", self.buf, pos)[0]
+        result = []
+        for i in range(count):
+            elem = pos + 4 + 4 * i
+            result.append(Table(self.buf, elem + struct.unpack_from("<I", self.buf, elem)[0]))
+        return result
+
+
+def model_operators(buf, path):
+    model = Table(buf, struct.unpack_from("<I", buf, 0)[0])
+    methods = []
+
+    # Model.operator_codes, OperatorCode: deprecated_builtin_code, custom_code, version,
+    # builtin_code
+    for code in model.tables(1):
+        builtin = max(code.scalar(0, "<b"), code.scalar(3, "<i"))
+        if builtin == 32:
+            custom = code.string(1)
+            if custom not in CUSTOM_OPERATORS:
+                sys.exit(f"{path}: unsupported custom operator '{custom}'")
+            methods.append(CUSTOM_OPERATORS[custom])
+        elif builtin in BUILTIN_OPERATORS:
+            methods.append(method_name(BUILTIN_OPERATORS[builtin]))
+        else:
+            sys.exit(f"{path}: unsupported builtin operator {builtin}")
+
+    return methods
+
+
+def generate(models, methods):
+    lines = [
+        "/* Generated by gen_op_resolver.py, do not edit.",
+        " *",
+        " * Models:",
+    ]
+    lines += [f" *   {model}" for model in models]
+    lines += [
+        " */",
+        "",
+        '#include "inference_process.hpp"',
+        "",
+        "#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>",
+        "",
+        "namespace InferenceProcess",
+        "{",
+        "std::unique_ptr<tflite::MicroOpResolver> createOpResolver()",
+        "{",
+        f"\tauto resolver = std::make_unique<tflite::MicroMutableOpResolver<{len(methods)}>>();",
+    ]
+    lines += [f"\tresolver->{method}();" for method in methods]
+    lines += [
+        "",
+        "\treturn resolver;",
+        "}",
+        "",
+        "} /* namespace InferenceProcess */",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("models", nargs="+", help=".tflite files or C sources with model arrays")
+    parser.add_argument("-o", "--output", required=True, help="generated C++ source")
+    parser.add_argument("-a", "--array", help="name of the model array in C sources")
+    args = parser.parse_args()
+
+    methods = []
+    for model in args.models:
+        for method in model_operators(read_model(model, args.array), model):
+            if method not in methods:
+                methods.append(method)
+
+    source = generate(args.models, sorted(methods))
+
+    # Keep the timestamp when nothing changed to avoid rebuilds
+    try:
+        with open(args.output, "r") as f:
+            if f.read() == source:
+                return
+    except OSError:
+        pass
+
+    with open(args.output, "w") as f:
+        f.write(source)
+
+
+if __name__ == "__main__":
+    main()
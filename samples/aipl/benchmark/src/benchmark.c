@@ -17,14 +17,59 @@
 #include "utmr.h"
 #include "cpu_usage.h"
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <stdlib.h>
+
+static void benchmark_record(benchmark_t *benchmark, uint32_t elapsed)
+{
+	if (benchmark->num_runs < benchmark->max_samples) {
+		benchmark->samples[benchmark->num_runs] = elapsed;
+	}
+
+	benchmark->execuion_time += elapsed;
+	++benchmark->num_runs;
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+	uint32_t lhs = *(const uint32_t *)a;
+	uint32_t rhs = *(const uint32_t *)b;
+
+	return (lhs > rhs) - (lhs < rhs);
+}
+
+/* Nearest rank: smallest sample with at least percent % of the samples at or below it */
+static uint32_t percentile(const uint32_t *sorted, uint32_t count, uint32_t percent)
+{
+	return sorted[(count * percent + 99) / 100 - 1];
+}
 
 benchmark_t benchmark_create(exec_wrap_func_t func)
 {
-	benchmark_t benchmark = {func, 0, 0, 0};
+	benchmark_t benchmark = {func, 0, 0, 0, NULL, 0};
 
 	return benchmark;
 }
 
+void benchmark_set_samples(benchmark_t *benchmark, uint32_t *samples, uint32_t max_samples)
+{
+	benchmark->samples = samples;
+	benchmark->max_samples = samples != NULL ? max_samples : 0;
+}
+
+uint32_t benchmark_warmup(benchmark_t *benchmark, void *arg, uint32_t num_runs)
+{
+	for (uint32_t i = 0; i < num_runs; ++i) {
+		uint32_t res = benchmark->wrapper_func(arg);
+
+		if (res != BENCHMARK_OK) {
+			return res;
+		}
+	}
+
+	return BENCHMARK_OK;
+}
+
 uint32_t benchmark_run_once(benchmark_t *benchmark, void *arg)
 {
 	uint32_t now = utimer_get_us();
@@ -35,32 +80,29 @@ uint32_t benchmark_run_once(benchmark_t *benchmark, void *arg)
 
 	uint32_t elapsed = utimer_get_us() - now;
 
-	benchmark->execuion_time += elapsed;
 	benchmark->idle_time += zephyr_get_idle_time();
-	++benchmark->num_runs;
+	benchmark_record(benchmark, elapsed);
 
 	return res;
 }
 
 uint32_t benchmark_run_for(benchmark_t *benchmark, void *arg, uint32_t num_runs)
 {
-	uint32_t now = utimer_get_us();
-
 	zephyr_get_idle_time();
 
 	for (uint32_t i = 0; i < num_runs; ++i) {
+		uint32_t now = utimer_get_us();
+
 		uint32_t res = benchmark->wrapper_func(arg);
 
 		if (res != BENCHMARK_OK) {
 			return res;
 		}
-	}
 
-	uint32_t elapsed = utimer_get_us() - now;
+		benchmark_record(benchmark, utimer_get_us() - now);
+	}
 
-	benchmark->execuion_time += elapsed;
 	benchmark->idle_time += zephyr_get_idle_time();
-	benchmark->num_runs += num_runs;
 
 	return BENCHMARK_OK;
 }
@@ -69,9 +111,39 @@ benchmark_result_t benchmark_summarize(const benchmark_t *benchmark)
 {
 	benchmark_result_t res = {0};
 
+	if (benchmark->num_runs == 0) {
+		return res;
+	}
+
+	res.num_runs = benchmark->num_runs;
 	res.avg_time = benchmark->execuion_time / benchmark->num_runs;
-	res.cpu_load =
-		(float)(benchmark->execuion_time - benchmark->idle_time) / benchmark->execuion_time;
+	res.cpu_load = benchmark->execuion_time == 0
+			       ? 0.0f
+			       : (float)(benchmark->execuion_time - benchmark->idle_time) /
+					 benchmark->execuion_time;
+
+	uint32_t count = MIN(benchmark->num_runs, benchmark->max_samples);
+
+	if (count == 0) {
+		return res;
+	}
+
+	qsort(benchmark->samples, count, sizeof(benchmark->samples[0]), compare_samples);
+
+	res.min_time = benchmark->samples[0];
+	res.max_time = benchmark->samples[count - 1];
+	res.median_time = count % 2 != 0 ? benchmark->samples[count / 2]
+					 : ((uint64_t)benchmark->samples[count / 2 - 1] +
+					    benchmark->samples[count / 2]) / 2;
+	res.p95_time = percentile(benchmark->samples, count, 95);
+	res.p99_time = percentile(benchmark->samples, count, 99);
 
 	return res;
 }
+
+void benchmark_reset(benchmark_t *benchmark)
+{
+	benchmark->execuion_time = 0;
+	benchmark->idle_time = 0;
+	benchmark->num_runs = 0;
+}
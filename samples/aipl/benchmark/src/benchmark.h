@@ -31,21 +31,41 @@ typedef struct {
 	uint32_t execuion_time;
 	uint32_t idle_time;
 	uint32_t num_runs;
+	/* Optional per-run durations [us], the first max_samples runs are recorded */
+	uint32_t *samples;
+	uint32_t max_samples;
 } benchmark_t;
 
 typedef struct {
+	uint32_t num_runs;
 	uint32_t avg_time;
+	/* Per-run statistics [us], 0 without recorded samples */
+	uint32_t min_time;
+	uint32_t median_time;
+	uint32_t p95_time;
+	uint32_t p99_time;
+	uint32_t max_time;
 	float cpu_load;
 } benchmark_result_t;
 
 benchmark_t benchmark_create(exec_wrap_func_t func);
 
+/* Record the duration of each run in samples, up to max_samples runs */
+void benchmark_set_samples(benchmark_t *benchmark, uint32_t *samples, uint32_t max_samples);
+
+/* Run without measuring, to warm up caches and lazily initialized state */
+uint32_t benchmark_warmup(benchmark_t *benchmark, void *arg, uint32_t num_runs);
+
 uint32_t benchmark_run_once(benchmark_t *benchmark, void *arg);
 
 uint32_t benchmark_run_for(benchmark_t *benchmark, void *arg, uint32_t num_runs);
 
+/* Sorts the recorded samples in place */
 benchmark_result_t benchmark_summarize(const benchmark_t *benchmark);
 
+/* Forget the measurements, keeping the function and the sample buffer */
+void benchmark_reset(benchmark_t *benchmark);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -15,9 +15,117 @@
 #include "graphics.h"
 #include "dbuf_display/display.h"
 #include "aipl_dave2d.h"
+#include <zephyr/sys/util.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
+#define BG_COLOR 0x00f0f0f0
+
+/* Initial and growth size of the display lists, in D/AVE2D display list blocks */
+#define DLIST_INITIAL_BLOCKS 20
+#define DLIST_STEP_BLOCKS    20
+
+#define NUM_DLISTS 2
+
+typedef struct {
+	d2_renderbuffer *dlists[NUM_DLISTS];
+	/* Display list given to D/AVE2D before the batch started */
+	d2_renderbuffer *saved_dlist;
+	/* Display list being recorded, the other one may be executing */
+	uint32_t recording;
+	void *target;
+	/* A frame is being rendered, not shown yet */
+	bool in_flight;
+	void *in_flight_target;
+	uint32_t in_flight_duration;
+	/* The recorded objects use the shared scratch buffer */
+	bool scratch_used;
+	bool active;
+	/* Bounding box of the objects of the frame being recorded, and of the previous frame */
+	graph_rect_t bounds;
+	graph_rect_t previous_bounds;
+} graph_batch_t;
+
+static graph_batch_t batch;
+
+static int batch_init(void)
+{
+	d2_device *handle = aipl_dave2d_handle();
+
+	for (uint32_t i = 0; i < NUM_DLISTS; ++i) {
+		if (batch.dlists[i] != NULL) {
+			continue;
+		}
+
+		batch.dlists[i] = d2_newrenderbuffer(handle, DLIST_INITIAL_BLOCKS, DLIST_STEP_BLOCKS);
+		if (batch.dlists[i] == NULL) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void rect_union(graph_rect_t *rect, const graph_rect_t *other)
+{
+	if (other->width == 0 || other->height == 0) {
+		return;
+	}
+
+	if (rect->width == 0 || rect->height == 0) {
+		*rect = *other;
+		return;
+	}
+
+	uint32_t x1 = MAX(rect->x + rect->width, other->x + other->width);
+	uint32_t y1 = MAX(rect->y + rect->height, other->y + other->height);
+
+	rect->x = MIN(rect->x, other->x);
+	rect->y = MIN(rect->y, other->y);
+	rect->width = x1 - rect->x;
+	rect->height = y1 - rect->y;
+}
+
+static void batch_add_dirty_rect(const graph_rect_t *rect)
+{
+	if (rect->width == 0 || rect->height == 0) {
+		return;
+	}
+
+	display_add_dirty_rect(batch.target, rect->x, rect->y, rect->width, rect->height);
+}
+
+/* Wait for the frame being rendered and show it */
+static void batch_complete_in_flight(void)
+{
+	if (!batch.in_flight) {
+		return;
+	}
+
+	d2_flushframe(aipl_dave2d_handle());
+
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+	display_submit_frame(batch.in_flight_target, batch.in_flight_duration);
+#else
+	display_next_frame();
+	display_set_next_frame_duration(batch.in_flight_duration);
+#endif
+
+	batch.in_flight = false;
+}
+
+/* Record into the display list again */
+static void batch_select(void)
+{
+	d2_device *handle = aipl_dave2d_handle();
+
+	d2_selectrenderbuffer(handle, batch.dlists[batch.recording]);
+
+	d2_framebuffer(handle, batch.target, display_width(), display_width(), display_height(),
+		       d2_mode_rgb565);
+}
+
 graph_frame_t graph_create_frame(uint32_t duration)
 {
 	graph_frame_t frame = {NULL, duration, NULL, d2_mode_argb8888};
@@ -43,35 +151,32 @@ void graph_draw_object(const graph_object_t *object)
 	d2_startframe(handle);
 }
 
-void graph_draw_frame(const graph_frame_t *frame)
+static void batch_draw_frame(const graph_frame_t *frame)
 {
-	d2_device *handle = aipl_dave2d_handle();
-
-	d2_framebuffer(handle, display_inactive_buffer(), display_width(), display_height(),
-		       display_height(), d2_mode_rgb565);
-
 	if (frame->clut != NULL) {
 		/* dave2d_set_clut((d2_color*)frame->clut, frame->clut_format); */
 	}
 
-	d2_endframe(handle);
-	d2_startframe(handle);
-
-	d2_clear(handle, 0x00f0f0f0);
+	if (graph_batch_begin() != 0) {
+		return;
+	}
 
 	graph_object_ll_t *node = frame->objects;
 
 	while (node != NULL) {
-		graph_draw_object(&node->object);
+		graph_batch_add_object(&node->object);
 
 		node = node->next;
 	}
 
-	d2_endframe(handle);
+	graph_batch_submit(frame->duration);
+}
 
-	display_next_frame();
+void graph_draw_frame(const graph_frame_t *frame)
+{
+	batch_draw_frame(frame);
 
-	display_set_next_frame_duration(frame->duration);
+	graph_batch_finish();
 }
 
 void graph_draw_scene(const graph_scene_t *scene)
@@ -79,10 +184,116 @@ void graph_draw_scene(const graph_scene_t *scene)
 	graph_frame_ll_t *node = scene->frames;
 
 	while (node != NULL) {
-		graph_draw_frame(&node->frame);
+		batch_draw_frame(&node->frame);
 
 		node = node->next;
 	}
+
+	graph_batch_finish();
+}
+
+int graph_batch_begin(void)
+{
+	d2_device *handle = aipl_dave2d_handle();
+
+	if (!batch.active) {
+		/* Display lists are allocated once, on first use */
+		if (batch_init() != 0) {
+			return -1;
+		}
+
+		/* Display list currently receiving the commands */
+		batch.saved_dlist = d2_getrenderbuffer(handle, 0);
+		batch.active = true;
+
+		/* Unknown frames may have been shown since the previous batch */
+		batch.previous_bounds = (graph_rect_t){0, 0, display_width(), display_height()};
+	}
+
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+	/* Kept when begun again without a submit */
+	if (batch.target == NULL) {
+		batch.target = display_acquire_back_buffer(K_FOREVER);
+	}
+#else
+	/* Without triple buffering frames do not overlap, the previous one is already shown */
+	batch.target = display_inactive_buffer();
+#endif
+	batch.scratch_used = false;
+	batch.bounds = (graph_rect_t){0};
+
+	batch_select();
+
+	d2_clear(handle, BG_COLOR);
+
+	/* Cleared to the background */
+	batch_add_dirty_rect(&batch.previous_bounds);
+
+	return 0;
+}
+
+void graph_batch_add_object(const graph_object_t *object)
+{
+	if (object->flags & GRAPH_OBJECT_SHARED_SCRATCH) {
+		/* The GPU may still read the scratch buffer for an earlier object */
+		batch_complete_in_flight();
+
+		if (batch.scratch_used) {
+			d2_device *handle = aipl_dave2d_handle();
+
+			d2_executerenderbuffer(handle, batch.dlists[batch.recording], 0);
+			d2_flushframe(handle);
+
+			batch_select();
+		}
+
+		batch.scratch_used = true;
+	}
+
+	object->draw_func(object->color_format, object->data);
+
+	batch_add_dirty_rect(&object->bounds);
+	rect_union(&batch.bounds, &object->bounds);
+}
+
+void graph_batch_submit(uint32_t duration)
+{
+	d2_device *handle = aipl_dave2d_handle();
+
+	batch_complete_in_flight();
+
+	d2_executerenderbuffer(handle, batch.dlists[batch.recording], 0);
+
+	batch.in_flight = true;
+	batch.in_flight_target = batch.target;
+	batch.in_flight_duration = duration;
+	batch.previous_bounds = batch.bounds;
+	batch.target = NULL;
+	batch.recording = (batch.recording + 1) % NUM_DLISTS;
+
+	if (!IS_ENABLED(CONFIG_GRAPHICS_OVERLAP_FRAMES)) {
+		batch_complete_in_flight();
+	}
+}
+
+void graph_batch_finish(void)
+{
+	if (!batch.active) {
+		return;
+	}
+
+	batch_complete_in_flight();
+
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+	if (batch.target != NULL) {
+		display_release_back_buffer(batch.target);
+	}
+#endif
+	batch.target = NULL;
+
+	d2_selectrenderbuffer(aipl_dave2d_handle(), batch.saved_dlist);
+
+	batch.active = false;
 }
 
 void graph_frame_add_object(graph_frame_t *frame, const graph_object_t *object)
@@ -156,5 +367,5 @@ void graph_clear_screen(void)
 {
 	d2_device *handle = aipl_dave2d_handle();
 
-	d2_clear(handle, 0x00f0f0f0);
+	d2_clear(handle, BG_COLOR);
 }
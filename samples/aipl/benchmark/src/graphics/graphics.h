@@ -21,8 +21,18 @@ extern "C" {
 
 #include <stdint.h>
 
+/* The draw function writes a CPU buffer shared by all objects, that the GPU reads afterwards */
+#define GRAPH_OBJECT_SHARED_SCRATCH (1 << 0)
+
 typedef void (*graph_draw_func_t)(uint32_t format, void *data);
 
+typedef struct {
+	uint32_t x;
+	uint32_t y;
+	uint32_t width;
+	uint32_t height;
+} graph_rect_t;
+
 typedef struct graph_object graph_object_t;
 
 typedef void (*graph_destroy_func_t)(graph_object_t *obj);
@@ -32,6 +42,9 @@ struct graph_object {
 	uint32_t color_format;
 	void *data;
 	graph_destroy_func_t destroy_func;
+	uint32_t flags;
+	/* Screen area drawn to, reported as dirty by batched rendering */
+	graph_rect_t bounds;
 };
 
 typedef struct graph_object_ll graph_object_ll_t;
@@ -63,10 +76,39 @@ graph_scene_t graph_create_scene(void);
 
 void graph_draw_object(const graph_object_t *object);
 
+/* Batched rendering, see graph_batch_begin() */
 void graph_draw_frame(const graph_frame_t *frame);
 
 void graph_draw_scene(const graph_scene_t *scene);
 
+/**
+ * Batched rendering: all objects of a frame are recorded into one D/AVE2D display list
+ * executed once, instead of one submission and wait per object as with graph_draw_object().
+ * Two display lists are used in turn: with CONFIG_GRAPHICS_OVERLAP_FRAMES (triple buffering
+ * only), the next frame is recorded while the GPU renders the previous one, which is only
+ * waited for and shown by the next graph_batch_submit() or by graph_batch_finish(). Objects flagged
+ * GRAPH_OBJECT_SHARED_SCRATCH wait for the GPU to be done with the previous such object.
+ * With CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER, shown frames are only queued for the flip thread
+ * and graph_batch_begin() waits for a free framebuffer instead. The bounds of the objects of
+ * the frame and of the previous one are given to display_add_dirty_rect(), the first frame of
+ * a batch is dirty as a whole.
+ *
+ * The batch owns the D/AVE2D device from graph_batch_begin() to graph_batch_finish(), no
+ * other D/AVE2D user (such as AIPL operations) may run in between.
+ *
+ * Start recording a frame, cleared to the background color. Returns non-zero if the display
+ * lists could not be allocated.
+ */
+int graph_batch_begin(void);
+
+void graph_batch_add_object(const graph_object_t *object);
+
+/* Render the recorded frame, shown for at least duration ms */
+void graph_batch_submit(uint32_t duration);
+
+/* Wait for the frame being rendered, show it, and give the device back */
+void graph_batch_finish(void);
+
 void graph_frame_add_object(graph_frame_t *frame, const graph_object_t *object);
 
 void graph_frame_set_clut(graph_frame_t *frame, uint32_t *clut, uint32_t format);
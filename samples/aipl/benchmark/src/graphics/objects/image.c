@@ -12,6 +12,7 @@
  * @file image.c
  */
 
+#include <stdbool.h>
 #include <stdlib.h>
 #include <zephyr/cache.h>
 #include "objects.h"
@@ -19,6 +20,7 @@
 #include "aipl_image.h"
 #include "aipl_color_conversion.h"
 #include "dbuf_display/display.h"
+#include "texture_cache.h"
 
 typedef struct {
 	uint32_t x;
@@ -27,9 +29,12 @@ typedef struct {
 	uint32_t pitch;
 	uint32_t width;
 	uint32_t height;
+	/* Converted copy from the texture cache, NULL when converted on every draw */
+	void *texture;
+	uint32_t generation;
 } graph_image_t;
 
-static void dave2d_image_draw(uint32_t format, const graph_image_t *image);
+static void dave2d_image_draw(uint32_t format, const graph_image_t *image, bool flush);
 static void graph_image_draw(uint32_t format, void *data);
 static void graph_image_destroy(graph_object_t *image);
 
@@ -41,8 +46,8 @@ static void graph_image_destroy(graph_object_t *image);
 
 static uint8_t IMG_CNV_ATTRS img_cnv_buff[DISPLAY_WIDTH * DISPLAY_HEIGHT * 4];
 
-graph_object_t graph_create_image(uint32_t x, uint32_t y, void *image, uint32_t pitch,
-				  uint32_t width, uint32_t height, d2_u32 format)
+static graph_image_t *graph_image_alloc(uint32_t x, uint32_t y, void *image, uint32_t pitch,
+					uint32_t width, uint32_t height)
 {
 	graph_image_t *img = (graph_image_t *)malloc(sizeof(graph_image_t));
 
@@ -52,16 +57,69 @@ graph_object_t graph_create_image(uint32_t x, uint32_t y, void *image, uint32_t
 	img->pitch = pitch;
 	img->width = width;
 	img->height = height;
+	img->texture = NULL;
+	img->generation = 0;
+
+	return img;
+}
+
+static uint32_t graph_image_flags(uint32_t format, const graph_image_t *img)
+{
+	/* Formats D/AVE2D cannot read are converted to img_cnv_buff when drawn, if not cached */
+	return aipl_dave2d_format_supported(format) || img->texture != NULL
+		       ? 0
+		       : GRAPH_OBJECT_SHARED_SCRATCH;
+}
+
+graph_object_t graph_create_image(uint32_t x, uint32_t y, void *image, uint32_t pitch,
+				  uint32_t width, uint32_t height, d2_u32 format)
+{
+	graph_image_t *img = graph_image_alloc(x, y, image, pitch, width, height);
 
-	graph_object_t object = {graph_image_draw, format, img, graph_image_destroy};
+	graph_object_t object = {graph_image_draw, format, img, graph_image_destroy,
+				 graph_image_flags(format, img), {x, y, width, height}};
 
 	return object;
 }
 
-static void dave2d_image_draw(uint32_t mode, const graph_image_t *image)
+graph_object_t graph_create_cached_image(uint32_t x, uint32_t y, void *image, uint32_t pitch,
+					 uint32_t width, uint32_t height, d2_u32 format)
 {
-	sys_cache_data_flush_range(image->image,
-			     image->pitch * image->height * aipl_dave2d_mode_px_size(mode));
+	graph_image_t *img = graph_image_alloc(x, y, image, pitch, width, height);
+
+	if (!aipl_dave2d_format_supported(format)) {
+		img->texture = texture_cache_acquire(image, pitch, width, height, format, 0);
+	}
+
+	graph_object_t object = {graph_image_draw, format, img, graph_image_destroy,
+				 graph_image_flags(format, img), {x, y, width, height}};
+
+	return object;
+}
+
+void graph_image_update(graph_object_t *object)
+{
+	graph_image_t *img = (graph_image_t *)object->data;
+
+	if (img->texture == NULL) {
+		return;
+	}
+
+	/* A new entry, the old one is freed on its last release once D/AVE2D is done with it */
+	texture_cache_invalidate(img->image);
+	texture_cache_release(img->texture);
+	img->texture = texture_cache_acquire(img->image, img->pitch, img->width, img->height,
+					     object->color_format, ++img->generation);
+
+	object->flags = graph_image_flags(object->color_format, img);
+}
+
+static void dave2d_image_draw(uint32_t mode, const graph_image_t *image, bool flush)
+{
+	if (flush) {
+		sys_cache_data_flush_range(image->image, image->pitch * image->height *
+								 aipl_dave2d_mode_px_size(mode));
+	}
 
 	d2_device *handle = aipl_dave2d_handle();
 
@@ -94,7 +152,13 @@ static void graph_image_draw(uint32_t format, void *data)
 	graph_image_t *image = (graph_image_t *)data;
 
 	if (aipl_dave2d_format_supported(format)) {
-		dave2d_image_draw(aipl_dave2d_format_to_mode(format), image);
+		dave2d_image_draw(aipl_dave2d_format_to_mode(format), image, true);
+	} else if (image->texture != NULL) {
+		graph_image_t converted = *image;
+
+		/* Flushed by the texture cache when converted */
+		converted.image = image->texture;
+		dave2d_image_draw(d2_mode_argb8888, &converted, false);
 	} else {
 		graph_image_t converted = {.x = image->x,
 					   .y = image->y,
@@ -106,11 +170,17 @@ static void graph_image_draw(uint32_t format, void *data)
 		aipl_color_convert(image->image, converted.image, image->pitch, image->width,
 				   image->height, format, AIPL_COLOR_ARGB8888);
 
-		dave2d_image_draw(d2_mode_argb8888, &converted);
+		dave2d_image_draw(d2_mode_argb8888, &converted, true);
 	}
 }
 
 static void graph_image_destroy(graph_object_t *image)
 {
+	graph_image_t *img = (graph_image_t *)image->data;
+
+	if (img->texture != NULL) {
+		texture_cache_release(img->texture);
+	}
+
 	free(image->data);
 }
@@ -28,6 +28,17 @@ graph_object_t graph_create_rectangle(uint32_t x, uint32_t y, uint32_t width, ui
 graph_object_t graph_create_image(uint32_t x, uint32_t y, void *image, uint32_t pitch,
 				  uint32_t width, uint32_t height, d2_u32 format);
 
+/*
+ * Image whose ARGB8888 conversion, for formats D/AVE2D cannot read, is kept in the texture
+ * cache instead of being redone on every draw. For images that do not change, or call
+ * graph_image_update() when they do.
+ */
+graph_object_t graph_create_cached_image(uint32_t x, uint32_t y, void *image, uint32_t pitch,
+					 uint32_t width, uint32_t height, d2_u32 format);
+
+/* The pixels of a cached image changed, older conversions of them are freed once unused */
+void graph_image_update(graph_object_t *object);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
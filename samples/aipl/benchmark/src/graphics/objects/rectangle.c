@@ -37,7 +37,8 @@ graph_object_t graph_create_rectangle(uint32_t x, uint32_t y, uint32_t width, ui
 	rect->height = height;
 	rect->color = color;
 
-	graph_object_t object = {graph_rectangle_draw, 0, rect, graph_rectangle_destroy};
+	graph_object_t object = {graph_rectangle_draw, 0, rect, graph_rectangle_destroy, 0,
+				 {x, y, width, height}};
 
 	return object;
 }
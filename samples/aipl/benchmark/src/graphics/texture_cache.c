@@ -0,0 +1,223 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file texture_cache.c
+ */
+
+#include "texture_cache.h"
+#include "aipl_color_conversion.h"
+#include "aipl_dave2d.h"
+#include "aipl_video_alloc.h"
+#include <zephyr/cache.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define NUM_ENTRIES CONFIG_GRAPHICS_TEXTURE_CACHE_ENTRIES
+
+typedef struct {
+	/* NULL once invalidated, the entry is then freed when released */
+	const void *src;
+	uint32_t pitch;
+	uint32_t width;
+	uint32_t height;
+	uint32_t format;
+	uint32_t generation;
+	void *texture;
+	uint32_t size;
+	uint32_t refs;
+	/* Value of use_counter at the last acquire */
+	uint32_t last_use;
+} texture_cache_entry_t;
+
+static texture_cache_entry_t entries[NUM_ENTRIES];
+static uint32_t used_bytes;
+static uint32_t use_counter;
+
+static void entry_free(texture_cache_entry_t *entry)
+{
+	/* Display lists executed or in flight may still read the texture */
+	d2_flushframe(aipl_dave2d_handle());
+
+	aipl_video_free(entry->texture);
+
+	used_bytes -= entry->size;
+	entry->texture = NULL;
+	entry->src = NULL;
+}
+
+/* Least recently used entry not in use, NULL if all are */
+static texture_cache_entry_t *find_victim(void)
+{
+	texture_cache_entry_t *victim = NULL;
+
+	for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+		texture_cache_entry_t *entry = &entries[i];
+
+		if (entry->texture == NULL || entry->refs != 0) {
+			continue;
+		}
+
+		/* Wrap-safe age comparison */
+		if (victim == NULL || (int32_t)(entry->last_use - victim->last_use) < 0) {
+			victim = entry;
+		}
+	}
+
+	return victim;
+}
+
+static texture_cache_entry_t *find_free_entry(void)
+{
+	for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+		if (entries[i].texture == NULL) {
+			return &entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void *allocate(uint32_t size)
+{
+	while (used_bytes + size > CONFIG_GRAPHICS_TEXTURE_CACHE_SIZE) {
+		texture_cache_entry_t *victim = find_victim();
+
+		if (victim == NULL) {
+			return NULL;
+		}
+		entry_free(victim);
+	}
+
+	void *texture = aipl_video_alloc(size);
+
+	/* Video memory is shared with the images, make room in it too */
+	while (texture == NULL) {
+		texture_cache_entry_t *victim = find_victim();
+
+		if (victim == NULL) {
+			return NULL;
+		}
+		entry_free(victim);
+
+		texture = aipl_video_alloc(size);
+	}
+
+	return texture;
+}
+
+void *texture_cache_acquire(const void *src, uint32_t pitch, uint32_t width, uint32_t height,
+			    uint32_t format, uint32_t generation)
+{
+	if (src == NULL) {
+		return NULL;
+	}
+
+	for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+		texture_cache_entry_t *entry = &entries[i];
+
+		if (entry->texture != NULL && entry->src == src && entry->pitch == pitch &&
+		    entry->width == width && entry->height == height && entry->format == format &&
+		    entry->generation == generation) {
+			++entry->refs;
+			entry->last_use = ++use_counter;
+			return entry->texture;
+		}
+	}
+
+	uint32_t size = pitch * height * 4;
+
+	if (size > CONFIG_GRAPHICS_TEXTURE_CACHE_SIZE) {
+		return NULL;
+	}
+
+	texture_cache_entry_t *entry = find_free_entry();
+
+	if (entry == NULL) {
+		entry = find_victim();
+		if (entry == NULL) {
+			return NULL;
+		}
+		entry_free(entry);
+	}
+
+	void *texture = allocate(size);
+
+	if (texture == NULL) {
+		return NULL;
+	}
+
+	if (aipl_color_convert((void *)src, texture, pitch, width, height, format,
+			       AIPL_COLOR_ARGB8888) != AIPL_ERR_OK) {
+		aipl_video_free(texture);
+		return NULL;
+	}
+
+	/* Written once, so flushed once instead of on every draw */
+	sys_cache_data_flush_range(texture, size);
+
+	entry->src = src;
+	entry->pitch = pitch;
+	entry->width = width;
+	entry->height = height;
+	entry->format = format;
+	entry->generation = generation;
+	entry->texture = texture;
+	entry->size = size;
+	entry->refs = 1;
+	entry->last_use = ++use_counter;
+
+	used_bytes += size;
+
+	return texture;
+}
+
+void texture_cache_release(const void *texture)
+{
+	for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+		texture_cache_entry_t *entry = &entries[i];
+
+		if (entry->texture != texture || entry->refs == 0) {
+			continue;
+		}
+
+		if (--entry->refs == 0 && entry->src == NULL) {
+			entry_free(entry);
+		}
+		return;
+	}
+}
+
+void texture_cache_invalidate(const void *src)
+{
+	for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+		texture_cache_entry_t *entry = &entries[i];
+
+		if (entry->texture == NULL || entry->src != src) {
+			continue;
+		}
+
+		if (entry->refs == 0) {
+			entry_free(entry);
+		} else {
+			/* Never matched again, freed on the last release */
+			entry->src = NULL;
+		}
+	}
+}
+
+void texture_cache_clear(void)
+{
+	for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+		if (entries[i].texture != NULL && entries[i].refs == 0) {
+			entry_free(&entries[i]);
+		}
+	}
+}
@@ -0,0 +1,47 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file texture_cache.h
+ *
+ * ARGB8888 copies of images in formats D/AVE2D cannot read, converted once and kept in video
+ * memory. Entries are keyed by source pointer, format, size and generation: bumping the
+ * generation when the pixels change gives a new entry while frames still being rendered keep
+ * reading the old one. Entries in use are pinned, the others are evicted least recently used
+ * first once CONFIG_GRAPHICS_TEXTURE_CACHE_ENTRIES or CONFIG_GRAPHICS_TEXTURE_CACHE_SIZE is
+ * reached. Freeing a texture first waits for D/AVE2D to finish rendering.
+ */
+
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Converted copy of src with the same pitch, pinned until released, NULL if out of memory */
+void *texture_cache_acquire(const void *src, uint32_t pitch, uint32_t width, uint32_t height,
+			    uint32_t format, uint32_t generation);
+
+void texture_cache_release(const void *texture);
+
+/* Forget every copy of src, to be called before src is freed or reused for other pixels */
+void texture_cache_invalidate(const void *src);
+
+/* Free every texture not in use */
+void texture_cache_clear(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /* TEXTURE_CACHE_H */
@@ -14,7 +14,8 @@
 
 #include "perf_tests.h"
 #include "objects.h"
-#include "img_assets/assets.h"
+#include "texture_cache.h"
+#include "img_assets/asset_decoder.h"
 
 #include "utmr.h"
 #include "fps_counter.h"
@@ -24,6 +25,7 @@
 #include "aipl_color_correction.h"
 #include "aipl_white_balance.h"
 #include "aipl_lut_transform.h"
+#include "aipl_resize.h"
 
 #include <math.h>
 
@@ -32,12 +34,19 @@
 #define D1_HEAP_SIZE 0x180000
 
 #define FRAME_TIME_MS    20
-#define NUM_MEASUREMENTS 100
 #define FPS_CNT_INT_MS   100
 #define COLOR_FORMATS    (AIPL_COLOR_UYVY + 1)
-#define NUM_OPERATIONS   (COLOR_FORMATS + 7)
+#define NUM_OPERATIONS   (COLOR_FORMATS + 11)
 #define TABLE_COL_WIDTH  20
 
+/* Scene benchmark: SCENE_SPRITES sprites per frame in rows of SCENE_COLUMNS */
+#define SCENE_FRAMES      10
+#define SCENE_SPRITES     48
+#define SCENE_COLUMNS     8
+#define SCENE_FRAME_SHIFT 4
+#define SPRITE_SIZE       48
+#define SPRITE_STEP       (SPRITE_SIZE + 8)
+
 #ifdef CONFIG_D0_HEAP_SECTION
 #define D0_HEAP_ATTRS __attribute__((section(CONFIG_D0_HEAP_SECTION)))
 #else
@@ -46,19 +55,31 @@
 
 static uint8_t D0_HEAP_ATTRS d0_heap[D1_HEAP_SIZE];
 
+#ifdef CONFIG_PIPELINE_SCRATCH_SECTION
+#define PIPELINE_SCRATCH_ATTRS __attribute__((section(CONFIG_PIPELINE_SCRATCH_SECTION)))
+#else
+#define PIPELINE_SCRATCH_ATTRS
+#endif
+
+static uint8_t PIPELINE_SCRATCH_ATTRS pipeline_scratch[CONFIG_PIPELINE_SCRATCH_SIZE]
+	__attribute__((aligned(32)));
+
+#include <zephyr/cache.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(app, CONFIG_LOG_DEFAULT_LEVEL);
 
 static char *bench_names[NUM_OPERATIONS] = {
-	"to ALPHA8",     "to ARGB8888",      "to ARGB4444", "to ARGB1555", "to RGBA8888",
-	"to RGBA4444",   "to RGBA5551",      "to BGR888",   "to RGB888",   "to RGB565",
-	"to YV12",       "to I420",          "to I422",     "to I444",     "to I400",
-	"to NV21",       "to NV12",          "to YUY2",     "to UYVY",     "Color correction",
-	"White balance", "Gamma correction", "Flipping",    "Cropping",    "Resize",
-	"Rotation",
+	"to ALPHA8",     "to ARGB8888",        "to ARGB4444",    "to ARGB1555",
+	"to RGBA8888",   "to RGBA4444",        "to RGBA5551",    "to BGR888",
+	"to RGB888",     "to RGB565",          "to YV12",        "to I420",
+	"to I422",       "to I444",            "to I400",        "to NV21",
+	"to NV12",       "to YUY2",            "to UYVY",        "Color correction",
+	"White balance", "Gamma correction",   "Flipping",       "Cropping",
+	"Resize",        "Rotation",           "Fused pipeline", "Unfused pipeline",
+	"Asset decode",  "Asset decode bands",
 };
-static benchmark_result_t bench_results[COLOR_FORMATS][NUM_OPERATIONS];
+static uint32_t bench_samples[CONFIG_BENCHMARK_ITERATIONS];
 
 static void prepare_color_conversion(aipl_image_t *src, aipl_image_t *dst, op_arg_t *args)
 {
@@ -114,8 +135,9 @@ static void prepare_gamma_correction(aipl_image_t *src, aipl_image_t *dst, gc_op
 
 static void prepare_cropping(aipl_image_t *src, aipl_image_t *dst, crop_op_arg_t *args)
 {
-	args->left = 200;
-	args->top = 100;
+	/* Centered, to fit at every size of the sweep */
+	args->left = (src->width - dst->width) / 2;
+	args->top = (src->height - dst->height) / 2;
 
 	args->src = src;
 	args->dst = dst;
@@ -145,14 +167,96 @@ static void prepare_rotation(aipl_image_t *src, aipl_image_t *dst, rot_op_arg_t
 	args->rotation = AIPL_ROTATE_90;
 }
 
-static benchmark_result_t perform_benchmark(const aipl_image_t *input, aipl_image_t *output,
-					    benchmark_t *bench, void *args, const char *name)
+/* Camera style preprocessing: centred 3/4 crop, resize to half size, RGB888, white balance
+ * and gamma. intermediate gets the outputs of the first stages for the unfused run.
+ */
+static void prepare_pipeline(aipl_image_t *src, aipl_image_t *dst, pipeline_t *pipeline,
+			     aipl_image_t *intermediate, pipeline_op_arg_t *args)
+{
+	gc_op_arg_t gc_args;
+	uint32_t crop_width = (src->width * 3 / 4) & ~3u;
+	uint32_t crop_height = (src->height * 3 / 4) & ~3u;
+	uint32_t left = (src->width - crop_width) / 2;
+	uint32_t top = (src->height - crop_height) / 2;
+
+	/* Only for its static LUT */
+	prepare_gamma_correction(src, dst, &gc_args);
+
+	pipeline_init(pipeline);
+	pipeline_add_crop(pipeline, left, top, left + crop_width, top + crop_height);
+	pipeline_add_resize(pipeline, dst->width, dst->height);
+	if (src->format != AIPL_COLOR_RGB888) {
+		pipeline_add_color_conversion(pipeline, AIPL_COLOR_RGB888);
+	}
+	pipeline_add_white_balance(pipeline, 1.2f, 0.8f, 0.6f);
+	pipeline_add_lut_transform(pipeline, gc_args.gamma_lut);
+
+	args->src = src;
+	args->dst = dst;
+	args->pipeline = pipeline;
+	args->scratch = pipeline_scratch;
+	args->scratch_size = sizeof(pipeline_scratch);
+
+	for (uint32_t i = 0; i + 1 < pipeline->num_stages; ++i) {
+		args->intermediate[i] = &intermediate[i];
+	}
+}
+
+/* dst is the whole image, or a band of it decoded over and over */
+static void prepare_asset_decode(aipl_image_t *dst, asset_op_arg_t *args)
+{
+	args->asset = &SAMPLE_PHOTO;
+	args->dst = dst;
+}
+
+static void print_samples(const aipl_image_t *input, const benchmark_t *bench, const char *name)
+{
+	uint32_t count = MIN(bench->num_runs, bench->max_samples);
+
+	printk("samples,%s,%s,%u,%u", aipl_color_format_str(input->format), name, input->width,
+	       input->height);
+
+	for (uint32_t i = 0; i < count; ++i) {
+		printk(",%u", bench->samples[i]);
+	}
+
+	printk("\n");
+}
+
+/* See the header printed by main() */
+static void print_result(const aipl_image_t *input, const char *name,
+			 const benchmark_result_t *res, float fps)
+{
+	printk("csv,%s,%s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%.1f,%.1f,%d,%d\n",
+	       aipl_color_format_str(input->format), name, input->width, input->height,
+	       res->num_runs, res->min_time, res->median_time, res->p95_time, res->p99_time,
+	       res->max_time, res->avg_time, (double)res->cpu_load * 100, (double)fps,
+	       IS_ENABLED(CONFIG_AIPL_DAVE2D_ACCELERATION),
+	       IS_ENABLED(CONFIG_AIPL_HELIUM_ACCELERATION));
+}
+
+/* in_place: the operation writes into input, whose cached conversion is redone after each run */
+static void perform_benchmark(const aipl_image_t *input, aipl_image_t *output, bool in_place,
+			      benchmark_t *bench, void *args, const char *name)
 {
 	utimer_start();
 
+	benchmark_set_samples(bench, bench_samples, ARRAY_SIZE(bench_samples));
+
+	if (benchmark_warmup(bench, args, CONFIG_BENCHMARK_WARMUP) != AIPL_ERR_OK) {
+		LOG_ERR("%s %s failed", aipl_color_format_str(input->format), name);
+		utimer_stop();
+		return;
+	}
+
 	fps_counter_t fps_counter = fps_counter_create(FPS_CNT_INT_MS * 1000);
 
-	for (uint32_t i = 0; i < NUM_MEASUREMENTS; ++i) {
+	/* The input is converted for display once, not on every frame */
+	graph_object_t img_obj1 = graph_create_cached_image(0, 40, input->data, input->pitch,
+							    input->width, input->height,
+							    input->format);
+
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_ITERATIONS; ++i) {
 		d2_device *handle = aipl_dave2d_handle();
 
 		d2_framebuffer(handle, display_inactive_buffer(), display_width(), display_width(),
@@ -161,13 +265,17 @@ static benchmark_result_t perform_benchmark(const aipl_image_t *input, aipl_imag
 		graph_clear_screen();
 
 		if (benchmark_run_once(bench, args) != AIPL_ERR_OK) {
-			benchmark_result_t res = {0, 0.0f};
-			return res;
+			LOG_ERR("%s %s failed", aipl_color_format_str(input->format), name);
+			graph_destroy_object(&img_obj1);
+			benchmark_reset(bench);
+			utimer_stop();
+			return;
+		}
+
+		if (in_place) {
+			graph_image_update(&img_obj1);
 		}
 
-		graph_object_t img_obj1 =
-			graph_create_image(0, 40, input->data, input->pitch, input->width,
-					   input->height, input->format);
 		graph_object_t img_obj2 =
 			graph_create_image(0, 400, output->data, output->pitch, output->width,
 					   output->height, output->format);
@@ -180,23 +288,407 @@ static benchmark_result_t perform_benchmark(const aipl_image_t *input, aipl_imag
 		fps_counter_add_frame(&fps_counter);
 		display_set_next_frame_duration(FRAME_TIME_MS);
 
-		graph_destroy_object(&img_obj1);
 		graph_destroy_object(&img_obj2);
 	}
 
+	graph_destroy_object(&img_obj1);
+
+	if (IS_ENABLED(CONFIG_BENCHMARK_PRINT_SAMPLES)) {
+		print_samples(input, bench, name);
+	}
+
+	benchmark_result_t res = benchmark_summarize(bench);
+
+	benchmark_reset(bench);
+
+	print_result(input, name, &res, fps_counter_get_average(&fps_counter));
+
+	utimer_stop();
+}
+
+/* Every operation with src as the source image */
+static void benchmark_source(aipl_image_t *src)
+{
+	/* Color conversions  */
+	benchmark_t cnv_bench = create_color_conversion_benchmark();
+
+	int j = AIPL_COLOR_ALPHA8;
+
+	for (; j < COLOR_FORMATS; ++j) {
+		if (src->format == j) {
+			continue;
+		}
+
+		aipl_image_t dst;
+
+		if (aipl_image_create(&dst, src->width, src->width, src->height, j) !=
+		    AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for color conversion destination image");
+			continue;
+		}
+
+		op_arg_t cnv_args;
+
+		prepare_color_conversion(src, &dst, &cnv_args);
+		perform_benchmark(src, &dst, false, &cnv_bench, &cnv_args, bench_names[j]);
+
+		aipl_image_destroy(&dst);
+	}
+
+	/* Destination of equal size and format */
+	{
+		aipl_image_t dst;
+
+		if (aipl_image_create(&dst, src->width, src->width, src->height, src->format) !=
+		    AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for destination image with the same "
+				"size as source");
+			return;
+		}
+		benchmark_t cc_bench = create_color_correction_benchmark();
+		cc_op_arg_t cc_args;
+
+		prepare_color_correction(src, &dst, &cc_args);
+		perform_benchmark(src, &dst, false, &cc_bench, &cc_args, bench_names[j]);
+		++j;
+
+		benchmark_t wb_bench = create_white_balance_benchmark();
+		wb_op_arg_t wb_args;
+
+		prepare_white_balance(src, &dst, &wb_args);
+		perform_benchmark(src, &dst, false, &wb_bench, &wb_args, bench_names[j]);
+		++j;
+
+		benchmark_t gc_bench = create_lut_transform_benchmark();
+		gc_op_arg_t gc_args;
+
+		prepare_gamma_correction(src, &dst, &gc_args);
+		perform_benchmark(src, &dst, false, &gc_bench, &gc_args, bench_names[j]);
+		++j;
+
+		benchmark_t flip_bench = create_flipping_benchmark();
+		flip_op_arg_t flip_args;
+
+		prepare_flipping(src, &dst, &flip_args);
+		perform_benchmark(src, &dst, false, &flip_bench, &flip_args, bench_names[j]);
+		++j;
+
+		aipl_image_destroy(&dst);
+	}
+
+	/* Destination is half width and height */
+	{
+		aipl_image_t dst;
+
+		if (aipl_image_create(&dst, src->width / 2, src->width / 2, src->height / 2,
+				      src->format) != AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for destination image with the half "
+				"source size");
+			return;
+		}
+
+		benchmark_t crop_bench = create_cropping_benchmark();
+		crop_op_arg_t crop_args;
+
+		prepare_cropping(src, &dst, &crop_args);
+		perform_benchmark(src, &dst, false, &crop_bench, &crop_args, bench_names[j]);
+		++j;
+
+		benchmark_t resize_bench = create_resize_benchmark();
+		op_arg_t resize_args;
+
+		prepare_resize(src, &dst, &resize_args);
+		perform_benchmark(src, &dst, false, &resize_bench, &resize_args, bench_names[j]);
+		++j;
+
+		aipl_image_destroy(&dst);
+	}
+
+	/* Rotation */
+	{
+		aipl_image_t dst;
+
+		if (aipl_image_create(&dst, src->height, src->height, src->width, src->format) !=
+		    AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for rotation destination image");
+			return;
+		}
+
+		benchmark_t rot_bench = create_rotation_benchmark();
+		rot_op_arg_t rot_args;
+
+		prepare_rotation(src, &dst, &rot_args);
+		perform_benchmark(src, &dst, false, &rot_bench, &rot_args, bench_names[j]);
+		++j;
+
+		aipl_image_destroy(&dst);
+	}
+
+	/* Fused pipeline and the same operations unfused */
+	{
+		aipl_image_t dst;
+		aipl_image_t intermediate[4] = {0};
+		pipeline_t pipeline;
+		pipeline_op_arg_t args;
+
+		if (aipl_image_create(&dst, src->width / 2, src->width / 2, src->height / 2,
+				      AIPL_COLOR_RGB888) != AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for pipeline destination image");
+			return;
+		}
+
+		prepare_pipeline(src, &dst, &pipeline, intermediate, &args);
+
+		if (pipeline_stripe_height(&pipeline, src, args.scratch_size) == 0) {
+			/* Unsupported format or scratch too small */
+			aipl_image_destroy(&dst);
+			return;
+		}
+
+		benchmark_t fused_bench = create_fused_pipeline_benchmark();
+
+		perform_benchmark(src, &dst, false, &fused_bench, &args, bench_names[j]);
+		++j;
+
+		const pipeline_stage_t *crop = &pipeline.stages[0];
+		uint32_t crop_width = crop->crop.right - crop->crop.left;
+		uint32_t crop_height = crop->crop.bottom - crop->crop.top;
+
+		if (aipl_image_create(&intermediate[0], crop_width, crop_width, crop_height,
+				      src->format) != AIPL_ERR_OK ||
+		    aipl_image_create(&intermediate[1], dst.width, dst.width, dst.height,
+				      src->format) != AIPL_ERR_OK ||
+		    aipl_image_create(&intermediate[2], dst.width, dst.width, dst.height,
+				      AIPL_COLOR_RGB888) != AIPL_ERR_OK ||
+		    aipl_image_create(&intermediate[3], dst.width, dst.width, dst.height,
+				      AIPL_COLOR_RGB888) != AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for unfused pipeline images");
+		} else {
+			benchmark_t unfused_bench = create_unfused_pipeline_benchmark();
+
+			perform_benchmark(src, &dst, false, &unfused_bench, &args, bench_names[j]);
+		}
+		++j;
+
+		for (uint32_t i = 0; i < ARRAY_SIZE(intermediate); ++i) {
+			if (intermediate[i].data != NULL) {
+				aipl_image_destroy(&intermediate[i]);
+			}
+		}
+		aipl_image_destroy(&dst);
+	}
+}
+
+/* Decode rate of the compressed photo to src's format, skipped if the decoder lacks it */
+static void benchmark_asset_decode(aipl_image_t *src)
+{
+	uint32_t bpp = asset_bytes_per_pixel(src->format);
+
+	if (bpp == 0) {
+		return;
+	}
+
+	benchmark_t decode_bench = create_asset_decode_benchmark();
+	asset_op_arg_t args;
+
+	/* Into the source image itself, rewriting the same pixels */
+	prepare_asset_decode(src, &args);
+	perform_benchmark(src, src, true, &decode_bench, &args, bench_names[NUM_OPERATIONS - 2]);
+
+	/* Band by band into scratch memory, without ever writing the full image. The source, left
+	 * unchanged, is drawn instead of the band, the scratch memory may not be visible to D/AVE2D
+	 */
+	uint32_t rows =
+		MIN(SAMPLE_PHOTO.band_height, sizeof(pipeline_scratch) / (src->width * bpp));
+	aipl_image_t band = {pipeline_scratch, src->width, src->width, rows, src->format};
+
+	if (rows == 0) {
+		return;
+	}
+
+	prepare_asset_decode(&band, &args);
+	perform_benchmark(src, src, false, &decode_bench, &args, bench_names[NUM_OPERATIONS - 1]);
+}
+
+/* New image of format with the sample photo, converted from ARGB8888 if the decoder lacks it */
+static int create_photo(aipl_image_t *image, uint32_t format)
+{
+	uint32_t width = SAMPLE_PHOTO.width;
+	uint32_t height = SAMPLE_PHOTO.height;
+	aipl_image_t argb;
+	image_t decoded;
+	int ret;
+
+	if (aipl_image_create(image, width, width, height, format) != AIPL_ERR_OK) {
+		return -ENOMEM;
+	}
+
+	uint32_t bpp = asset_bytes_per_pixel(format);
+	bool direct = bpp != 0;
+
+	if (!direct && aipl_image_create(&argb, width, width, height, AIPL_COLOR_ARGB8888) !=
+			       AIPL_ERR_OK) {
+		aipl_image_destroy(image);
+		return -ENOMEM;
+	}
+
+	decoded = (image_t){.data = direct ? image->data : argb.data,
+			    .pitch = width,
+			    .width = width,
+			    .height = height,
+			    .format = direct ? format : AIPL_COLOR_ARGB8888};
+
+	ret = asset_decode(&SAMPLE_PHOTO, &decoded);
+
+	if (!direct) {
+		if (ret == 0) {
+			sys_cache_data_flush_range(argb.data, width * height * 4);
+			if (aipl_color_convert_img(&argb, image) != AIPL_ERR_OK) {
+				ret = -EIO;
+			}
+		}
+		aipl_image_destroy(&argb);
+	} else if (ret == 0) {
+		sys_cache_data_flush_range(image->data, width * height * bpp);
+	}
+
+	if (ret) {
+		aipl_image_destroy(image);
+	}
+
+	return ret;
+}
+
+/* One run draws every frame of the scene, the frame rate is the one of the runs */
+static void perform_scene_benchmark(const aipl_image_t *sprites, benchmark_t *bench,
+				    scene_op_arg_t *args, const char *name)
+{
+	utimer_start();
+
+	benchmark_set_samples(bench, bench_samples, ARRAY_SIZE(bench_samples));
+
+	if (benchmark_warmup(bench, args, CONFIG_BENCHMARK_WARMUP) != AIPL_ERR_OK ||
+	    benchmark_run_for(bench, args, CONFIG_BENCHMARK_ITERATIONS) != AIPL_ERR_OK) {
+		LOG_ERR("%s failed", name);
+		benchmark_reset(bench);
+		utimer_stop();
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_BENCHMARK_PRINT_SAMPLES)) {
+		print_samples(sprites, bench, name);
+	}
+
 	benchmark_result_t res = benchmark_summarize(bench);
 
-	bench->execuion_time = 0;
-	bench->idle_time = 0;
-	bench->num_runs = 0;
+	benchmark_reset(bench);
 
-	/* Color format, Test name, CPU load[%%], Avg. time[us], Avg. FPS, DAVE2D */
-	printk("%s,%s,%u,%.1f,%.1f\r\n", aipl_color_format_str(input->format), name, res.avg_time,
-	       (double)res.cpu_load * 100, (double)fps_counter_get_average(&fps_counter));
+	print_result(sprites, name, &res,
+		     res.avg_time != 0 ? SCENE_FRAMES * 1000000.0f / res.avg_time : 0.0f);
 
 	utimer_stop();
+}
+
+/*
+ * Frames of SCENE_SPRITES tiles of the photo moving right, drawn batched by graph_draw_scene()
+ * and with graph_draw_object() for every sprite
+ */
+static void benchmark_scene(void)
+{
+	aipl_image_t photo;
+	graph_scene_t scene = graph_create_scene();
+	uint32_t columns = SAMPLE_PHOTO.width / SPRITE_SIZE;
+
+	if (create_photo(&photo, AIPL_COLOR_ARGB8888)) {
+		LOG_ERR("Failed to decode source image");
+		return;
+	}
+
+	for (uint32_t i = 0; i < SCENE_FRAMES; ++i) {
+		/* Not held on screen, drawn as fast as possible */
+		graph_frame_t frame = graph_create_frame(0);
+
+		for (uint32_t j = 0; j < SCENE_SPRITES; ++j) {
+			uint32_t x = (j % SCENE_COLUMNS) * SPRITE_STEP + i * SCENE_FRAME_SHIFT;
+			uint32_t y = 40 + (j / SCENE_COLUMNS) * SPRITE_STEP;
+			uint32_t tile = (j % columns) * SPRITE_SIZE +
+					(j / columns) * SPRITE_SIZE * photo.pitch;
+			graph_object_t sprite =
+				graph_create_image(x, y, (uint32_t *)photo.data + tile, photo.pitch,
+						   SPRITE_SIZE, SPRITE_SIZE, photo.format);
+
+			graph_frame_add_object(&frame, &sprite);
+		}
+
+		graph_scene_add_frame(&scene, &frame);
+	}
+
+	/* The sprite size, the sprite format */
+	aipl_image_t sprites = {photo.data, photo.pitch, SPRITE_SIZE, SPRITE_SIZE, photo.format};
+	scene_op_arg_t args = {&scene};
+
+	benchmark_t objects_bench = create_draw_scene_objects_benchmark();
+
+	perform_scene_benchmark(&sprites, &objects_bench, &args, "Scene per object");
+
+	benchmark_t scene_bench = create_draw_scene_benchmark();
+
+	perform_scene_benchmark(&sprites, &scene_bench, &args,
+				IS_ENABLED(CONFIG_GRAPHICS_OVERLAP_FRAMES) ? "Scene overlapped"
+									   : "Scene batched");
+
+	graph_destroy_scene(&scene);
+	aipl_image_destroy(&photo);
+}
+
+/* Every source format at the full size of the photo, decoded straight to that format */
+static void benchmark_photo(void)
+{
+	for (int i = AIPL_COLOR_ALPHA8; i < COLOR_FORMATS; ++i) {
+		aipl_image_t src;
+
+		if (create_photo(&src, i)) {
+			LOG_ERR("Failed to decode source image");
+			continue;
+		}
+
+		benchmark_asset_decode(&src);
+		benchmark_source(&src);
+
+		texture_cache_invalidate(src.data);
+		aipl_image_destroy(&src);
+	}
+}
+
+/* Every source format at the size of image */
+static void benchmark_size(aipl_image_t *image)
+{
+	for (int i = AIPL_COLOR_ALPHA8; i < COLOR_FORMATS; ++i) {
+		aipl_image_t src;
+
+		if (image->format == i) {
+			src = *image;
+		} else {
+			if (aipl_image_create(&src, image->width, image->width, image->height, i) !=
+			    AIPL_ERR_OK) {
+				LOG_ERR("Not enough memory for source image");
+				continue;
+			}
+
+			if (aipl_color_convert_img(image, &src) != AIPL_ERR_OK) {
+				LOG_ERR("Failed to convert source image");
+				aipl_image_destroy(&src);
+				continue;
+			}
+		}
 
-	return res;
+		benchmark_source(&src);
+
+		texture_cache_invalidate(src.data);
+		if (image->format != i) {
+			aipl_image_destroy(&src);
+		}
+	}
 }
 
 int main(void)
@@ -225,11 +717,6 @@ int main(void)
 	/* Initialize utimer */
 	utimer_init();
 
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-
-	aipl_image_t image = {test_img->data, test_img->pitch, test_img->width, test_img->height,
-			      test_img->format};
-
 	utimer_start();
 
 	cpu_usage_enable();
@@ -247,154 +734,56 @@ int main(void)
 	LOG_INF("AIPL HELIUM ACCELERATION DISABLED");
 #endif
 
-	printk("Color format,Test name,Avg. time[us],CPU load[%%],Avg. FPS\n");
+	printk("csv,format,test,width,height,runs,min_us,median_us,p95_us,p99_us,max_us,avg_us,"
+	       "cpu_load_pct,fps,dave2d,helium\n");
 
-	for (int i = AIPL_COLOR_ALPHA8; i < COLOR_FORMATS; ++i) {
-		aipl_image_t src;
+	benchmark_scene();
 
-		if (image.format == i) {
-			src = image;
-		} else {
-			if (aipl_image_create(&src, image.width, image.width, image.height, i) !=
-			    AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for source image");
-				continue;
-			}
+	benchmark_photo();
 
-			if (aipl_color_convert_img(&image, &src) != AIPL_ERR_OK) {
-				LOG_ERR("Failed to convert source image");
-				aipl_image_destroy(&src);
-				continue;
-			}
-		}
-
-		/* Color conversions  */
-		benchmark_t cnv_bench = create_color_conversion_benchmark();
-
-		int j = AIPL_COLOR_ALPHA8;
-
-		for (; j < COLOR_FORMATS; ++j) {
-			if (i == j) {
-				continue;
-			}
-
-			aipl_image_t dst;
+	for (uint32_t step = 1; step < CONFIG_BENCHMARK_SIZE_STEPS; ++step) {
+		/* Halved at each step, multiples of 4 keep YUV planes and halves even */
+		aipl_image_t image;
+		aipl_image_t scaled;
+		uint32_t width = (SAMPLE_PHOTO.width >> step) & ~3u;
+		uint32_t height = (SAMPLE_PHOTO.height >> step) & ~3u;
 
-			if (aipl_image_create(&dst, src.width, src.width, src.height, j) !=
-			    AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for color conversion destination image");
-				continue;
-			}
-
-			op_arg_t cnv_args;
-
-			prepare_color_conversion(&src, &dst, &cnv_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &cnv_bench, &cnv_args,
-								bench_names[j]);
-
-			aipl_image_destroy(&dst);
+		if (width == 0 || height == 0) {
+			break;
 		}
 
-		/* Destination of equal size and format */
-		{
-			aipl_image_t dst;
-
-			if (aipl_image_create(&dst, src.width, src.width, src.height, src.format) !=
-			    AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for destination image with the same "
-					"size as source");
-				continue;
-			}
-			benchmark_t cc_bench = create_color_correction_benchmark();
-			cc_op_arg_t cc_args;
-
-			prepare_color_correction(&src, &dst, &cc_args);
-			bench_results[i][j] =
-				perform_benchmark(&src, &dst, &cc_bench, &cc_args, bench_names[j]);
-			++j;
-
-			benchmark_t wb_bench = create_white_balance_benchmark();
-			wb_op_arg_t wb_args;
-
-			prepare_white_balance(&src, &dst, &wb_args);
-			bench_results[i][j] =
-				perform_benchmark(&src, &dst, &wb_bench, &wb_args, bench_names[j]);
-			++j;
-
-			benchmark_t gc_bench = create_lut_transform_benchmark();
-			gc_op_arg_t gc_args;
-
-			prepare_gamma_correction(&src, &dst, &gc_args);
-			bench_results[i][j] =
-				perform_benchmark(&src, &dst, &gc_bench, &gc_args, bench_names[j]);
-			++j;
-
-			benchmark_t flip_bench = create_flipping_benchmark();
-			flip_op_arg_t flip_args;
-
-			prepare_flipping(&src, &dst, &flip_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &flip_bench, &flip_args,
-								bench_names[j]);
-			++j;
-
-			aipl_image_destroy(&dst);
+		if (create_photo(&image, AIPL_COLOR_ARGB8888)) {
+			LOG_ERR("Failed to decode source image");
+			break;
 		}
 
-		/* Destination is half width and height */
-		{
-			aipl_image_t dst;
-
-			if (aipl_image_create(&dst, src.width / 2, src.width / 2, src.height / 2,
-					      src.format) != AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for destination image with the half "
-					"source size");
-				continue;
-			}
-
-			benchmark_t crop_bench = create_cropping_benchmark();
-			crop_op_arg_t crop_args;
-
-			prepare_cropping(&src, &dst, &crop_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &crop_bench, &crop_args,
-								bench_names[j]);
-			++j;
-
-			benchmark_t resize_bench = create_resize_benchmark();
-			op_arg_t resize_args;
-
-			prepare_resize(&src, &dst, &resize_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &resize_bench,
-								&resize_args, bench_names[j]);
-			++j;
+		if (aipl_image_create(&scaled, width, width, height, image.format) != AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for %ux%u source image", width, height);
+			aipl_image_destroy(&image);
+			continue;
+		}
 
-			aipl_image_destroy(&dst);
+		if (aipl_resize_img(&image, &scaled, true) != AIPL_ERR_OK) {
+			LOG_ERR("Failed to resize source image to %ux%u", width, height);
+			aipl_image_destroy(&image);
+			aipl_image_destroy(&scaled);
+			continue;
 		}
 
-		/* Rotation */
-		{
-			aipl_image_t dst;
+		aipl_image_destroy(&image);
 
-			if (aipl_image_create(&dst, src.height, src.height, src.width,
-					      src.format) != AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for rotation destination image");
-				continue;
-			}
+		benchmark_size(&scaled);
 
-			benchmark_t rot_bench = create_rotation_benchmark();
-			rot_op_arg_t rot_args;
+		aipl_image_destroy(&scaled);
+	}
 
-			prepare_rotation(&src, &dst, &rot_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &rot_bench, &rot_args,
-								bench_names[j]);
-			++j;
+	texture_cache_clear();
 
-			aipl_image_destroy(&dst);
-		}
+	struct display_stats display_stats;
 
-		if (image.format != i) {
-			aipl_image_destroy(&src);
-		}
-	}
+	display_get_stats(&display_stats);
+	LOG_INF("Display frames %u, late %u, dropped %u, partial %u", display_stats.frames,
+		display_stats.late, display_stats.dropped, display_stats.partial);
 
 	LOG_INF("Benchmark complete");
 
@@ -0,0 +1,42 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file asset_decode_test.c
+ */
+
+#include "perf_tests.h"
+#include <zephyr/sys/util.h>
+
+static uint32_t asset_decode_wrapper(void *arg);
+
+benchmark_t create_asset_decode_benchmark(void)
+{
+	return benchmark_create(&asset_decode_wrapper);
+}
+
+/* The whole asset, dst->height rows at a time */
+static uint32_t asset_decode_wrapper(void *arg)
+{
+	asset_op_arg_t *args = (asset_op_arg_t *)arg;
+	/* Off the small main stack */
+	static asset_decoder_t decoder;
+	int ret = asset_decoder_init(&decoder, args->asset);
+
+	for (uint32_t row = 0; row < args->asset->height && ret == 0; row += args->dst->height) {
+		uint32_t rows = MIN(args->dst->height, args->asset->height - row);
+
+		ret = asset_decode_rows(&decoder, args->dst->data, args->dst->pitch, rows,
+					args->dst->format);
+	}
+
+	/* Negative errno values are non-zero like the AIPL errors */
+	return ret;
+}
@@ -0,0 +1,66 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file draw_scene_test.c
+ */
+
+#include "perf_tests.h"
+#include "graphics.h"
+#include "aipl_dave2d.h"
+#include "dbuf_display/display.h"
+
+static uint32_t draw_scene_wrapper(void *arg);
+static uint32_t draw_scene_objects_wrapper(void *arg);
+
+benchmark_t create_draw_scene_benchmark(void)
+{
+	return benchmark_create(&draw_scene_wrapper);
+}
+
+benchmark_t create_draw_scene_objects_benchmark(void)
+{
+	return benchmark_create(&draw_scene_objects_wrapper);
+}
+
+/* Every frame of the scene as one display list */
+static uint32_t draw_scene_wrapper(void *arg)
+{
+	scene_op_arg_t *args = (scene_op_arg_t *)arg;
+
+	graph_draw_scene(args->scene);
+
+	return 0;
+}
+
+/* The same frames with one submission and wait per object */
+static uint32_t draw_scene_objects_wrapper(void *arg)
+{
+	scene_op_arg_t *args = (scene_op_arg_t *)arg;
+	d2_device *handle = aipl_dave2d_handle();
+
+	for (graph_frame_ll_t *frame = args->scene->frames; frame != NULL; frame = frame->next) {
+		d2_framebuffer(handle, display_inactive_buffer(), display_width(), display_width(),
+			       display_height(), d2_mode_rgb565);
+
+		graph_clear_screen();
+
+		for (graph_object_ll_t *node = frame->frame.objects; node != NULL;
+		     node = node->next) {
+			graph_draw_object(&node->object);
+		}
+
+		d2_endframe(handle);
+		display_next_frame();
+		display_set_next_frame_duration(frame->frame.duration);
+	}
+
+	return 0;
+}
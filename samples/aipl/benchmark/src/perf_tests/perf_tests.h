@@ -23,6 +23,9 @@ extern "C" {
 #include "benchmark.h"
 #include "aipl_image.h"
 #include "aipl_rotate.h"
+#include "pipeline.h"
+#include "img_assets/asset_decoder.h"
+#include "graphics.h"
 
 typedef struct {
 	aipl_image_t *src;
@@ -71,8 +74,32 @@ typedef struct {
 	aipl_rotation_t rotation;
 } rot_op_arg_t;
 
+typedef struct {
+	aipl_image_t *src;
+	aipl_image_t *dst;
+	const pipeline_t *pipeline;
+	void *scratch;
+	uint32_t scratch_size;
+	/* Outputs of all the stages but the last one, used by the unfused run only */
+	aipl_image_t *intermediate[PIPELINE_MAX_STAGES - 1];
+} pipeline_op_arg_t;
+
+typedef struct {
+	const compressed_image_t *asset;
+	/* The asset size and format, or a band of fewer rows overwritten by every next band */
+	aipl_image_t *dst;
+} asset_op_arg_t;
+
+typedef struct {
+	const graph_scene_t *scene;
+} scene_op_arg_t;
+
 benchmark_t create_draw_object_benchmark(void);
 
+benchmark_t create_draw_scene_benchmark(void);
+
+benchmark_t create_draw_scene_objects_benchmark(void);
+
 benchmark_t create_color_conversion_benchmark(void);
 
 benchmark_t create_color_correction_benchmark(void);
@@ -89,6 +116,12 @@ benchmark_t create_flipping_benchmark(void);
 
 benchmark_t create_rotation_benchmark(void);
 
+benchmark_t create_fused_pipeline_benchmark(void);
+
+benchmark_t create_unfused_pipeline_benchmark(void);
+
+benchmark_t create_asset_decode_benchmark(void);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -0,0 +1,78 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file pipeline_test.c
+ */
+
+#include "perf_tests.h"
+#include "aipl_crop.h"
+#include "aipl_color_conversion.h"
+#include "aipl_white_balance.h"
+#include "aipl_lut_transform.h"
+
+static uint32_t fused_pipeline_wrapper(void *arg);
+static uint32_t unfused_pipeline_wrapper(void *arg);
+
+benchmark_t create_fused_pipeline_benchmark(void)
+{
+	return benchmark_create(&fused_pipeline_wrapper);
+}
+
+benchmark_t create_unfused_pipeline_benchmark(void)
+{
+	return benchmark_create(&unfused_pipeline_wrapper);
+}
+
+static uint32_t fused_pipeline_wrapper(void *arg)
+{
+	pipeline_op_arg_t *args = (pipeline_op_arg_t *)arg;
+
+	/* Negative errno values are non-zero like the AIPL errors */
+	return pipeline_run(args->pipeline, args->src, args->dst, args->scratch,
+			    args->scratch_size);
+}
+
+/* The same operations one after the other, through full-size images */
+static uint32_t unfused_pipeline_wrapper(void *arg)
+{
+	pipeline_op_arg_t *args = (pipeline_op_arg_t *)arg;
+	uint32_t ret = AIPL_ERR_OK;
+
+	for (uint32_t i = 0; i < args->pipeline->num_stages && ret == AIPL_ERR_OK; ++i) {
+		const pipeline_stage_t *stage = &args->pipeline->stages[i];
+		aipl_image_t *in = i == 0 ? args->src : args->intermediate[i - 1];
+		aipl_image_t *out =
+			i + 1 == args->pipeline->num_stages ? args->dst : args->intermediate[i];
+
+		switch (stage->op) {
+		case PIPELINE_CROP:
+			ret = aipl_crop_img(in, out, stage->crop.left, stage->crop.top,
+					    stage->crop.right, stage->crop.bottom);
+			break;
+		case PIPELINE_RESIZE:
+			ret = pipeline_resize_img(in, out);
+			break;
+		case PIPELINE_COLOR_CONVERSION:
+			ret = aipl_color_convert_img(in, out);
+			break;
+		case PIPELINE_WHITE_BALANCE:
+			ret = aipl_white_balance_rgb_img(in, out, stage->white_balance.ar,
+							 stage->white_balance.ag,
+							 stage->white_balance.ab);
+			break;
+		case PIPELINE_LUT_TRANSFORM:
+			ret = aipl_lut_transform_rgb_img(in, out, stage->lut_transform.lut);
+			break;
+		}
+	}
+
+	return ret;
+}
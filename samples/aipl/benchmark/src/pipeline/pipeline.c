@@ -0,0 +1,557 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file pipeline.c
+ */
+
+#include "pipeline.h"
+#include "aipl_color_conversion.h"
+#include "aipl_white_balance.h"
+#include "aipl_lut_transform.h"
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* Stripe buffers start on cache line boundaries */
+#define STRIPE_ALIGN 32
+
+typedef struct {
+	/* Stages after the crop */
+	uint32_t first;
+	/* Source window */
+	uint32_t left;
+	uint32_t top;
+	uint32_t width;
+	uint32_t height;
+	/* Resize stage, PIPELINE_MAX_STAGES if none, and its input and output sizes */
+	uint32_t resize;
+	uint32_t in_width;
+	uint32_t in_height;
+	uint32_t out_width;
+	uint32_t out_height;
+	uint32_t out_format;
+	/* Largest pixel of the intermediate formats, in bytes */
+	uint32_t max_px_size;
+} pipeline_plan_t;
+
+/* Pixel size in bytes of the formats addressable by row, 0 for the others */
+static uint32_t format_px_size(uint32_t format)
+{
+	switch (format) {
+	case AIPL_COLOR_ALPHA8:
+	case AIPL_COLOR_I400:
+		return 1;
+	case AIPL_COLOR_ARGB4444:
+	case AIPL_COLOR_ARGB1555:
+	case AIPL_COLOR_RGBA4444:
+	case AIPL_COLOR_RGBA5551:
+	case AIPL_COLOR_RGB565:
+	/* Two pixels in four bytes, with an even x */
+	case AIPL_COLOR_YUY2:
+	case AIPL_COLOR_UYVY:
+		return 2;
+	case AIPL_COLOR_BGR888:
+	case AIPL_COLOR_RGB888:
+		return 3;
+	case AIPL_COLOR_ARGB8888:
+	case AIPL_COLOR_RGBA8888:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+/* Formats resized channel by channel, every byte being one channel */
+static bool format_byte_channels(uint32_t format)
+{
+	switch (format) {
+	case AIPL_COLOR_ALPHA8:
+	case AIPL_COLOR_I400:
+	case AIPL_COLOR_BGR888:
+	case AIPL_COLOR_RGB888:
+	case AIPL_COLOR_ARGB8888:
+	case AIPL_COLOR_RGBA8888:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/* View of rows [row, row + height) of an image */
+static aipl_image_t image_rows(const aipl_image_t *image, uint32_t left, uint32_t row,
+			       uint32_t width, uint32_t height)
+{
+	uint32_t px_size = format_px_size(image->format);
+	aipl_image_t view = *image;
+
+	view.data = (uint8_t *)image->data + ((size_t)row * image->pitch + left) * px_size;
+	view.width = width;
+	view.height = height;
+
+	return view;
+}
+
+/* Compact image of width x height in a stripe buffer */
+static aipl_image_t stripe_image(void *buffer, uint32_t width, uint32_t height, uint32_t format)
+{
+	aipl_image_t image = {0};
+
+	image.data = buffer;
+	image.pitch = width;
+	image.width = width;
+	image.height = height;
+	image.format = format;
+
+	return image;
+}
+
+/*
+ * Source coordinate of destination coordinate pos, pixel centers aligned, in Q8: the integer
+ * part is the first of the two interpolated pixels, the fraction the weight of the second.
+ */
+static uint32_t resize_coord(uint32_t pos, uint32_t src_len, uint32_t dst_len)
+{
+	int64_t coord = (int64_t)(2 * pos + 1) * src_len * 256 / (2 * dst_len) - 128;
+
+	if (coord < 0) {
+		return 0;
+	}
+	if (coord > (int64_t)(src_len - 1) * 256) {
+		return (src_len - 1) * 256;
+	}
+
+	return (uint32_t)coord;
+}
+
+/* First and last source rows read for destination rows [first, last] */
+static uint32_t resize_first_row(uint32_t first, uint32_t src_len, uint32_t dst_len)
+{
+	return resize_coord(first, src_len, dst_len) >> 8;
+}
+
+static uint32_t resize_last_row(uint32_t last, uint32_t src_len, uint32_t dst_len)
+{
+	uint32_t row = resize_coord(last, src_len, dst_len) >> 8;
+
+	return row + 1 < src_len ? row + 1 : row;
+}
+
+/*
+ * Destination rows [first, first + dst->height) of a src_width x src_height image resized to
+ * dst_width x dst_height, src holding the source rows from src_first. x_coords caches
+ * resize_coord() of the destination columns.
+ */
+static void resize_rows(const aipl_image_t *src, uint32_t src_first, uint32_t src_height,
+			aipl_image_t *dst, uint32_t first, uint32_t dst_height,
+			const uint32_t *x_coords)
+{
+	uint32_t px_size = format_px_size(src->format);
+	uint32_t src_stride = src->pitch * px_size;
+	uint32_t dst_stride = dst->pitch * px_size;
+
+	for (uint32_t y = 0; y < dst->height; ++y) {
+		uint32_t coord = resize_coord(first + y, src_height, dst_height);
+		uint32_t row0 = coord >> 8;
+		uint32_t row1 = row0 + 1 < src_height ? row0 + 1 : row0;
+		uint32_t fy = coord & 0xff;
+
+		const uint8_t *line0 = (const uint8_t *)src->data + (row0 - src_first) * src_stride;
+		const uint8_t *line1 = (const uint8_t *)src->data + (row1 - src_first) * src_stride;
+		uint8_t *out = (uint8_t *)dst->data + y * dst_stride;
+
+		for (uint32_t x = 0; x < dst->width; ++x) {
+			uint32_t col0 = x_coords[x] >> 8;
+			uint32_t col1 = col0 + 1 < src->width ? col0 + 1 : col0;
+			uint32_t fx = x_coords[x] & 0xff;
+
+			for (uint32_t c = 0; c < px_size; ++c) {
+				uint32_t p00 = line0[col0 * px_size + c];
+				uint32_t p01 = line0[col1 * px_size + c];
+				uint32_t p10 = line1[col0 * px_size + c];
+				uint32_t p11 = line1[col1 * px_size + c];
+
+				uint32_t top = p00 * (256 - fx) + p01 * fx;
+				uint32_t bottom = p10 * (256 - fx) + p11 * fx;
+
+				out[x * px_size + c] =
+					(uint8_t)((top * (256 - fy) + bottom * fy + 32768) >> 16);
+			}
+		}
+	}
+}
+
+static void resize_x_coords(uint32_t *x_coords, uint32_t src_width, uint32_t dst_width)
+{
+	for (uint32_t x = 0; x < dst_width; ++x) {
+		x_coords[x] = resize_coord(x, src_width, dst_width);
+	}
+}
+
+static int plan_pipeline(const pipeline_t *pipeline, const aipl_image_t *src,
+			 pipeline_plan_t *plan)
+{
+	memset(plan, 0, sizeof(*plan));
+
+	plan->width = src->width;
+	plan->height = src->height;
+	plan->resize = PIPELINE_MAX_STAGES;
+
+	uint32_t format = src->format;
+
+	if (format_px_size(format) == 0) {
+		return -ENOTSUP;
+	}
+
+	if (pipeline->num_stages > 0 && pipeline->stages[0].op == PIPELINE_CROP) {
+		const pipeline_stage_t *crop = &pipeline->stages[0];
+
+		if (crop->crop.left >= crop->crop.right || crop->crop.top >= crop->crop.bottom ||
+		    crop->crop.right > src->width || crop->crop.bottom > src->height) {
+			return -EINVAL;
+		}
+
+		plan->left = crop->crop.left;
+		plan->top = crop->crop.top;
+		plan->width = crop->crop.right - crop->crop.left;
+		plan->height = crop->crop.bottom - crop->crop.top;
+		plan->first = 1;
+	}
+
+	uint32_t width = plan->width;
+	uint32_t height = plan->height;
+
+	for (uint32_t i = plan->first; i < pipeline->num_stages; ++i) {
+		const pipeline_stage_t *stage = &pipeline->stages[i];
+
+		switch (stage->op) {
+		case PIPELINE_RESIZE:
+			if (plan->resize != PIPELINE_MAX_STAGES || stage->resize.width == 0 ||
+			    stage->resize.height == 0) {
+				return -EINVAL;
+			}
+			if (!format_byte_channels(format)) {
+				return -ENOTSUP;
+			}
+			plan->resize = i;
+			plan->in_width = width;
+			plan->in_height = height;
+			width = stage->resize.width;
+			height = stage->resize.height;
+			break;
+		case PIPELINE_COLOR_CONVERSION:
+			format = stage->color_conversion.format;
+			if (format_px_size(format) == 0) {
+				return -ENOTSUP;
+			}
+			break;
+		case PIPELINE_WHITE_BALANCE:
+		case PIPELINE_LUT_TRANSFORM:
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		plan->max_px_size = MAX(plan->max_px_size, format_px_size(format));
+	}
+
+	plan->out_width = width;
+	plan->out_height = height;
+	plan->out_format = format;
+
+	return 0;
+}
+
+/* Size of one stripe buffer for stripes of rows destination rows */
+static uint32_t stripe_buffer_size(const pipeline_plan_t *plan, uint32_t rows)
+{
+	uint32_t size = rows * plan->out_width;
+
+	if (plan->resize != PIPELINE_MAX_STAGES) {
+		/* Source rows of the resize, interpolation included */
+		uint32_t src_rows = MIN(plan->in_height,
+					(rows * plan->in_height + plan->out_height - 1) /
+							plan->out_height + 2);
+
+		size = MAX(size, src_rows * plan->in_width);
+	}
+
+	return ROUND_UP(size * plan->max_px_size, STRIPE_ALIGN);
+}
+
+/* Two stripe buffers, then the resize column table */
+static uint32_t scratch_needed(const pipeline_plan_t *plan, uint32_t rows)
+{
+	uint32_t size = 2 * stripe_buffer_size(plan, rows);
+
+	if (plan->resize != PIPELINE_MAX_STAGES) {
+		size += plan->out_width * sizeof(uint32_t);
+	}
+
+	return size;
+}
+
+static uint32_t plan_stripe_height(const pipeline_plan_t *plan, uint32_t scratch_size)
+{
+	uint32_t rows = 0;
+
+	/* Grows with the rows, linear search as images are a few hundred rows high */
+	while (rows < plan->out_height && scratch_needed(plan, rows + 1) <= scratch_size) {
+		++rows;
+	}
+
+	return rows;
+}
+
+static int run_stage(const pipeline_stage_t *stage, const aipl_image_t *in, aipl_image_t *out)
+{
+	aipl_error_t ret;
+
+	switch (stage->op) {
+	case PIPELINE_COLOR_CONVERSION:
+		ret = aipl_color_convert_img((aipl_image_t *)in, out);
+		break;
+	case PIPELINE_WHITE_BALANCE:
+		ret = aipl_white_balance_rgb_img((aipl_image_t *)in, out, stage->white_balance.ar,
+						 stage->white_balance.ag, stage->white_balance.ab);
+		break;
+	case PIPELINE_LUT_TRANSFORM:
+		ret = aipl_lut_transform_rgb_img((aipl_image_t *)in, out, stage->lut_transform.lut);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return ret == AIPL_ERR_OK ? 0 : -EIO;
+}
+
+void pipeline_init(pipeline_t *pipeline)
+{
+	pipeline->num_stages = 0;
+}
+
+static pipeline_stage_t *add_stage(pipeline_t *pipeline, pipeline_op_t op)
+{
+	if (pipeline->num_stages == PIPELINE_MAX_STAGES) {
+		return NULL;
+	}
+
+	pipeline_stage_t *stage = &pipeline->stages[pipeline->num_stages++];
+
+	stage->op = op;
+
+	return stage;
+}
+
+int pipeline_add_crop(pipeline_t *pipeline, uint32_t left, uint32_t top, uint32_t right,
+		      uint32_t bottom)
+{
+	pipeline_stage_t *stage = add_stage(pipeline, PIPELINE_CROP);
+
+	if (stage == NULL) {
+		return -ENOMEM;
+	}
+
+	stage->crop.left = left;
+	stage->crop.top = top;
+	stage->crop.right = right;
+	stage->crop.bottom = bottom;
+
+	return 0;
+}
+
+int pipeline_add_resize(pipeline_t *pipeline, uint32_t width, uint32_t height)
+{
+	pipeline_stage_t *stage = add_stage(pipeline, PIPELINE_RESIZE);
+
+	if (stage == NULL) {
+		return -ENOMEM;
+	}
+
+	stage->resize.width = width;
+	stage->resize.height = height;
+
+	return 0;
+}
+
+int pipeline_add_color_conversion(pipeline_t *pipeline, uint32_t format)
+{
+	pipeline_stage_t *stage = add_stage(pipeline, PIPELINE_COLOR_CONVERSION);
+
+	if (stage == NULL) {
+		return -ENOMEM;
+	}
+
+	stage->color_conversion.format = format;
+
+	return 0;
+}
+
+int pipeline_add_white_balance(pipeline_t *pipeline, float ar, float ag, float ab)
+{
+	pipeline_stage_t *stage = add_stage(pipeline, PIPELINE_WHITE_BALANCE);
+
+	if (stage == NULL) {
+		return -ENOMEM;
+	}
+
+	stage->white_balance.ar = ar;
+	stage->white_balance.ag = ag;
+	stage->white_balance.ab = ab;
+
+	return 0;
+}
+
+int pipeline_add_lut_transform(pipeline_t *pipeline, uint8_t *lut)
+{
+	pipeline_stage_t *stage = add_stage(pipeline, PIPELINE_LUT_TRANSFORM);
+
+	if (stage == NULL) {
+		return -ENOMEM;
+	}
+
+	stage->lut_transform.lut = lut;
+
+	return 0;
+}
+
+uint32_t pipeline_stripe_height(const pipeline_t *pipeline, const aipl_image_t *src,
+				uint32_t scratch_size)
+{
+	pipeline_plan_t plan;
+
+	if (plan_pipeline(pipeline, src, &plan) != 0) {
+		return 0;
+	}
+
+	return plan_stripe_height(&plan, scratch_size);
+}
+
+int pipeline_run(const pipeline_t *pipeline, const aipl_image_t *src, aipl_image_t *dst,
+		 void *scratch, uint32_t scratch_size)
+{
+	pipeline_plan_t plan;
+	int ret = plan_pipeline(pipeline, src, &plan);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (dst->width != plan.out_width || dst->height != plan.out_height ||
+	    dst->format != plan.out_format) {
+		return -EINVAL;
+	}
+
+	/* Crop only */
+	if (plan.first == pipeline->num_stages) {
+		uint32_t px_size = format_px_size(src->format);
+
+		for (uint32_t y = 0; y < plan.height; ++y) {
+			aipl_image_t in = image_rows(src, plan.left, plan.top + y, plan.width, 1);
+			aipl_image_t out = image_rows(dst, 0, y, plan.width, 1);
+
+			memcpy(out.data, in.data, plan.width * px_size);
+		}
+
+		return 0;
+	}
+
+	uint32_t rows = plan_stripe_height(&plan, scratch_size);
+
+	if (rows == 0) {
+		return -ENOMEM;
+	}
+
+	uint32_t buffer_size = stripe_buffer_size(&plan, rows);
+	uint8_t *buffers[2] = {(uint8_t *)scratch, (uint8_t *)scratch + buffer_size};
+	uint32_t *x_coords = (uint32_t *)((uint8_t *)scratch + 2 * buffer_size);
+
+	if (plan.resize != PIPELINE_MAX_STAGES) {
+		resize_x_coords(x_coords, plan.in_width, plan.out_width);
+	}
+
+	uint32_t last = pipeline->num_stages - 1;
+
+	for (uint32_t first = 0; first < plan.out_height; first += rows) {
+		uint32_t stripe_rows = MIN(rows, plan.out_height - first);
+		/* Rows of the stripe before the resize, relative to the source window */
+		uint32_t src_first = first;
+		uint32_t src_rows = stripe_rows;
+
+		if (plan.resize != PIPELINE_MAX_STAGES) {
+			src_first = resize_first_row(first, plan.in_height, plan.out_height);
+			src_rows = resize_last_row(first + stripe_rows - 1, plan.in_height,
+						   plan.out_height) +
+				   1 - src_first;
+		}
+
+		aipl_image_t in =
+			image_rows(src, plan.left, plan.top + src_first, plan.width, src_rows);
+		uint32_t next = 0;
+
+		for (uint32_t i = plan.first; i <= last; ++i) {
+			const pipeline_stage_t *stage = &pipeline->stages[i];
+			bool resized = i >= plan.resize;
+			uint32_t out_rows = resized ? stripe_rows : src_rows;
+			uint32_t out_width = resized ? plan.out_width : plan.width;
+			uint32_t out_format = stage->op == PIPELINE_COLOR_CONVERSION
+						      ? stage->color_conversion.format
+						      : in.format;
+			aipl_image_t out;
+
+			if (i == last) {
+				out = image_rows(dst, 0, first, plan.out_width, stripe_rows);
+			} else {
+				out = stripe_image(buffers[next], out_width, out_rows, out_format);
+				next ^= 1;
+			}
+
+			if (i == plan.resize) {
+				resize_rows(&in, src_first, plan.in_height, &out, first,
+					    plan.out_height, x_coords);
+			} else {
+				ret = run_stage(stage, &in, &out);
+				if (ret != 0) {
+					return ret;
+				}
+			}
+
+			in = out;
+		}
+	}
+
+	return 0;
+}
+
+int pipeline_resize_img(const aipl_image_t *src, aipl_image_t *dst)
+{
+	if (src->format != dst->format || !format_byte_channels(src->format) ||
+	    dst->width == 0 || dst->height == 0) {
+		return -EINVAL;
+	}
+
+	/* Column table on the stack, in chunks of destination columns */
+	uint32_t x_coords[64];
+
+	for (uint32_t x = 0; x < dst->width; x += ARRAY_SIZE(x_coords)) {
+		uint32_t cols = MIN(ARRAY_SIZE(x_coords), dst->width - x);
+		aipl_image_t src_view = *src;
+		aipl_image_t dst_view = image_rows(dst, x, 0, cols, dst->height);
+
+		for (uint32_t i = 0; i < cols; ++i) {
+			x_coords[i] = resize_coord(x + i, src->width, dst->width);
+		}
+
+		resize_rows(&src_view, 0, src->height, &dst_view, 0, dst->height, x_coords);
+	}
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file pipeline.h
+ *
+ * Chain of AIPL operations executed stripe by stripe: every stage processes a few rows of the
+ * image at a time, going through two stripe buffers in a caller provided scratch area (meant to
+ * be DTCM), so no full-size intermediate image is written to or read back from SRAM.
+ *
+ * Stages:
+ * - crop: only as the first stage, it just offsets the source rows
+ * - resize: bilinear, at most one, on formats with 8-bit channels only (ALPHA8, I400,
+ *   ARGB8888, RGBA8888, BGR888, RGB888). Run by the pipeline itself, as its source rows only
+ *   depend on the destination row, making the result independent of the stripe height
+ * - color conversion, white balance, LUT transform: the AIPL functions on stripe views
+ *
+ * Formats must be addressable by row: planar and semi-planar YUV formats are not supported.
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "aipl_image.h"
+
+#define PIPELINE_MAX_STAGES 8
+
+typedef enum {
+	PIPELINE_CROP,
+	PIPELINE_RESIZE,
+	PIPELINE_COLOR_CONVERSION,
+	PIPELINE_WHITE_BALANCE,
+	PIPELINE_LUT_TRANSFORM,
+} pipeline_op_t;
+
+typedef struct {
+	pipeline_op_t op;
+	union {
+		struct {
+			uint32_t left;
+			uint32_t top;
+			uint32_t right;
+			uint32_t bottom;
+		} crop;
+		struct {
+			uint32_t width;
+			uint32_t height;
+		} resize;
+		struct {
+			uint32_t format;
+		} color_conversion;
+		struct {
+			float ar;
+			float ag;
+			float ab;
+		} white_balance;
+		struct {
+			uint8_t *lut;
+		} lut_transform;
+	};
+} pipeline_stage_t;
+
+typedef struct {
+	pipeline_stage_t stages[PIPELINE_MAX_STAGES];
+	uint32_t num_stages;
+} pipeline_t;
+
+void pipeline_init(pipeline_t *pipeline);
+
+/* The stage builders return 0, or -ENOMEM when the pipeline is full */
+int pipeline_add_crop(pipeline_t *pipeline, uint32_t left, uint32_t top, uint32_t right,
+		      uint32_t bottom);
+
+int pipeline_add_resize(pipeline_t *pipeline, uint32_t width, uint32_t height);
+
+int pipeline_add_color_conversion(pipeline_t *pipeline, uint32_t format);
+
+int pipeline_add_white_balance(pipeline_t *pipeline, float ar, float ag, float ab);
+
+int pipeline_add_lut_transform(pipeline_t *pipeline, uint8_t *lut);
+
+/**
+ * Run the pipeline from src to dst, which must have the size and format of the last stage.
+ * Stripes are as high as scratch_size allows.
+ *
+ * @return 0, -EINVAL for an invalid chain or dst, -ENOTSUP for an unsupported format,
+ *         -ENOMEM if scratch cannot hold a stripe of one row, -EIO if an AIPL operation fails
+ */
+int pipeline_run(const pipeline_t *pipeline, const aipl_image_t *src, aipl_image_t *dst,
+		 void *scratch, uint32_t scratch_size);
+
+/* Stripe height pipeline_run() uses with scratch_size bytes, 0 if not even one row fits */
+uint32_t pipeline_stripe_height(const pipeline_t *pipeline, const aipl_image_t *src,
+				uint32_t scratch_size);
+
+/* The pipeline resize on whole images, the unfused equivalent of the resize stage */
+int pipeline_resize_img(const aipl_image_t *src, aipl_image_t *dst);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /* PIPELINE_H */
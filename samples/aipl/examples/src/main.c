@@ -23,9 +23,10 @@
 #include <math.h>
 
 #include "image.h"
-#include "img_assets/assets.h"
+#include "img_assets/asset_decoder.h"
 #include "dbuf_display/display.h"
 
+#include <zephyr/cache.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(app, CONFIG_LOG_DEFAULT_LEVEL);
@@ -40,12 +41,41 @@ LOG_MODULE_REGISTER(app, CONFIG_LOG_DEFAULT_LEVEL);
 
 static uint8_t D0_HEAP_ATTRS d0_heap[D1_HEAP_SIZE];
 
+/* The sample photo, decoded once from its compressed asset */
+static aipl_image_t sample_image;
+
+static int load_sample_image(void)
+{
+	image_t decoded;
+	int ret;
+
+	if (aipl_image_create(&sample_image, SAMPLE_PHOTO.width, SAMPLE_PHOTO.width,
+			      SAMPLE_PHOTO.height, AIPL_COLOR_ARGB8888) != AIPL_ERR_OK) {
+		return -ENOMEM;
+	}
+
+	decoded = (image_t){.data = sample_image.data,
+			    .pitch = sample_image.pitch,
+			    .width = sample_image.width,
+			    .height = sample_image.height,
+			    .format = COLOR_ARGB8888};
+
+	ret = asset_decode(&SAMPLE_PHOTO, &decoded);
+	if (ret) {
+		aipl_image_destroy(&sample_image);
+		return ret;
+	}
+
+	/* Read by D/AVE2D */
+	sys_cache_data_flush_range(sample_image.data, sample_image.pitch * sample_image.height * 4);
+
+	return 0;
+}
+
 static void crop_scale_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_image;
 
 	/* Prepare the destination image for cropping */
 	uint32_t p = src_image.pitch / 4;
@@ -88,9 +118,7 @@ static void crop_scale_example(void)
 static void crop_flip_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_image;
 
 	/* Prepare the destination image for cropping */
 	uint32_t p = src_image.pitch / 2;
@@ -133,9 +161,7 @@ static void crop_flip_example(void)
 static void scale_rotate_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_image;
 
 	/* Prepare the destination image for scaling */
 	uint32_t p = src_image.pitch / 2;
@@ -182,9 +208,7 @@ static void scale_rotate_example(void)
 static void color_conversion_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_image;
 
 	/* Prepare the destination buffer for converted image */
 	aipl_image_t dst_image;
@@ -213,9 +237,7 @@ static void color_conversion_example(void)
 static void color_correction_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_image;
 
 	/* Prepare the destination color corrected image */
 	aipl_image_t dst_image;
@@ -247,9 +269,7 @@ static void color_correction_example(void)
 static void white_balance_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_image;
 
 	/* Prepare the destination white balanced image */
 	aipl_image_t dst_image;
@@ -278,9 +298,7 @@ static void white_balance_example(void)
 static void gamma_correction_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_image;
 
 	/* Prepare the destination color corrected image */
 	aipl_image_t dst_image;
@@ -326,9 +344,7 @@ static void gamma_correction_example(void)
 static void exposure_adjustment_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_image;
 
 	/* Prepare the destination color corrected image */
 	aipl_image_t dst_image;
@@ -384,6 +400,11 @@ int main(void)
 		return -1;
 	}
 
+	if (load_sample_image()) {
+		LOG_ERR("Failed to decode the sample image");
+		return -1;
+	}
+
 	/* Run AIPL examples */
 	while (true) {
 		LOG_INF("Example 1: Crop the image and scale it up");
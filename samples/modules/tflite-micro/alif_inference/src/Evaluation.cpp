@@ -0,0 +1,222 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/printk.h>
+
+#include "Evaluation.h"
+#include "KWSModel.h"
+#include "LiveMicInput.h"
+#include "WavAudioBackend.hpp"
+
+LOG_MODULE_REGISTER(Evaluation);
+
+namespace arm::app::kws
+{
+extern const float g_ScoreThreshold;
+} // namespace arm::app::kws
+
+/* A clip is classified from the window of its last stride */
+static constexpr size_t StrideSamples = LiveMicInput::OutputSize / sizeof(int16_t);
+static constexpr size_t ClipStrides = CONFIG_I2S_SAMPLE_RATE / StrideSamples;
+
+namespace
+{
+/* Time of one pipeline stage over all strides */
+struct StageTime {
+	uint64_t totalUs = 0;
+	uint64_t maxUs = 0;
+
+	void Add(uint64_t us)
+	{
+		totalUs += us;
+		maxUs = us > maxUs ? us : maxUs;
+	}
+};
+
+/* Simulated time does not advance while computing, stages are timed on the host clock */
+uint64_t HostTimeUs()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return static_cast<uint64_t>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+}
+
+/* Label index of a clip, words the model does not know are _unknown_ */
+int FindLabel(const char *label)
+{
+	int unknown = -1;
+
+	for (size_t i = 0; i < KWSModel::Result::NumLabels; i++) {
+		const char *name = KWSModel::Result::GetLabelName(i);
+
+		if (strcmp(name, label) == 0) {
+			return i;
+		}
+		if (strcmp(name, "_unknown_") == 0) {
+			unknown = i;
+		}
+	}
+
+	return unknown;
+}
+
+void PresentStage(const char *name, const StageTime &time, uint32_t strides)
+{
+	LOG_INF("%-15s mean %8.3f ms, max %8.3f ms", name,
+		strides ? (double)time.totalUs / strides / 1000 : 0.0, (double)time.maxUs / 1000);
+}
+} // namespace
+
+bool EvaluateClips(void)
+{
+	static KWSModel model;
+	static LiveMicInput input;
+
+	/* Clips per expected label, and those classified right */
+	uint32_t labelClips[KWSModel::Result::NumLabels] = {};
+	uint32_t labelCorrect[KWSModel::Result::NumLabels] = {};
+	uint32_t clips = 0;
+	uint32_t skipped = 0;
+	uint32_t correct = 0;
+	uint32_t detected = 0;
+	uint32_t strides = 0;
+	StageTime preTime;
+	StageTime infTime;
+	StageTime postTime;
+
+	if (!model.Init()) {
+		return false;
+	}
+
+	if (!input.Start()) {
+		return false;
+	}
+
+	struct wav_clip clip;
+	int err;
+
+	while ((err = wav_next_clip(&clip)) != -ENODATA) {
+		const int expected = err ? -1 : FindLabel(clip.label);
+
+		if (expected < 0) {
+			LOG_WRN("Skipping %s", clip.path);
+			skipped++;
+			continue;
+		}
+
+		/* Longer clips are cut, shorter ones padded with silence */
+		for (size_t stride = 0; stride < ClipStrides; stride++) {
+			if (!input.GetInputData(model.GetInputBuffer())) {
+				LOG_ERR("%s: read failed", clip.path);
+				input.Stop();
+				return false;
+			}
+
+			const uint64_t start = HostTimeUs();
+
+			if (!model.PreProcess()) {
+				input.Stop();
+				return false;
+			}
+			const uint64_t preEnd = HostTimeUs();
+
+			if (!model.RunInference()) {
+				input.Stop();
+				return false;
+			}
+			const uint64_t infEnd = HostTimeUs();
+
+			if (!model.PostProcess()) {
+				LOG_ERR("PostProcess failed");
+				input.Stop();
+				return false;
+			}
+			const uint64_t postEnd = HostTimeUs();
+
+			preTime.Add(preEnd - start);
+			infTime.Add(infEnd - preEnd);
+			postTime.Add(postEnd - infEnd);
+			strides++;
+		}
+
+		const auto &top = model.GetResult().top[0];
+		const bool right = static_cast<int>(top.index) == expected;
+
+		clips++;
+		labelClips[expected]++;
+		if (right) {
+			correct++;
+			labelCorrect[expected]++;
+			detected += top.score >= arm::app::kws::g_ScoreThreshold ? 1 : 0;
+		}
+
+		LOG_DBG("%s: %s, classified %s (%f)", clip.path,
+			KWSModel::Result::GetLabelName(expected),
+			KWSModel::Result::GetLabelName(top.index), static_cast<double>(top.score));
+	}
+
+	input.Stop();
+
+	const uint64_t processingUs = preTime.totalUs + infTime.totalUs + postTime.totalUs;
+	const uint64_t audioUs =
+		static_cast<uint64_t>(strides) * StrideSamples * 1000000 / CONFIG_I2S_SAMPLE_RATE;
+	const double realTimeFactor = audioUs ? (double)processingUs / audioUs : 0.0;
+	const double accuracy = clips ? 100.0 * correct / clips : 0.0;
+
+	LOG_INF("Clips: %" PRIu32 " classified, %" PRIu32 " skipped", clips, skipped);
+	LOG_INF("Accuracy: %.2f%% (%" PRIu32 " right), %" PRIu32
+		" right above the %.2f threshold",
+		accuracy, correct, detected, (double)arm::app::kws::g_ScoreThreshold);
+
+	for (size_t i = 0; i < KWSModel::Result::NumLabels; i++) {
+		if (labelClips[i]) {
+			LOG_INF("  %-10s %6.2f%% of %" PRIu32, KWSModel::Result::GetLabelName(i),
+				100.0 * labelCorrect[i] / labelClips[i], labelClips[i]);
+		}
+	}
+
+	LOG_INF("Per stride of %zu samples, %" PRIu32 " strides:", StrideSamples, strides);
+	PresentStage("PreProcess", preTime, strides);
+	PresentStage("RunInference", infTime, strides);
+	PresentStage("PostProcess", postTime, strides);
+	LOG_INF("Real-time factor: %.4f (%.3f s of processing for %.3f s of audio)",
+		realTimeFactor, (double)processingUs / 1000000, (double)audioUs / 1000000);
+
+	/* Same columns as the alif_kws host build, for scripts comparing runs */
+	printk("csv,clips,skipped,accuracy_pct,detected,pre_mean_us,inf_mean_us,post_mean_us,"
+	       "real_time_factor\n");
+	printk("csv,%" PRIu32 ",%" PRIu32 ",%.2f,%" PRIu32 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+	       ",%.4f\n",
+	       clips, skipped, accuracy, detected, strides ? preTime.totalUs / strides : 0,
+	       strides ? infTime.totalUs / strides : 0, strides ? postTime.totalUs / strides : 0,
+	       realTimeFactor);
+
+	if (clips == 0) {
+		LOG_ERR("No clip classified");
+		return false;
+	}
+
+	/* Matched by the twister entry of the sample */
+	if (accuracy < CONFIG_KWS_EVAL_MIN_ACCURACY) {
+		LOG_ERR("Evaluation failed, accuracy below %d%%", CONFIG_KWS_EVAL_MIN_ACCURACY);
+		return false;
+	}
+
+	LOG_INF("Evaluation passed, accuracy of at least %d%%", CONFIG_KWS_EVAL_MIN_ACCURACY);
+
+	return true;
+}
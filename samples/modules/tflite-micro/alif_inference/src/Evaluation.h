@@ -0,0 +1,22 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#ifndef EVALUATION_H
+#define EVALUATION_H
+
+/*
+ * Host build (CONFIG_KWS_WAV_INPUT): classify the labelled WAV clips one by one, each streamed
+ * stride by stride from LiveMicInput through KWSModel, and report the accuracy, the time of
+ * each stage and the real-time factor.
+ *
+ * Returns true when the accuracy reaches CONFIG_KWS_EVAL_MIN_ACCURACY.
+ */
+bool EvaluateClips(void);
+
+#endif /* EVALUATION_H */
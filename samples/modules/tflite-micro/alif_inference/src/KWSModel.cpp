@@ -2,7 +2,6 @@
 
 #include "KWSModel.h"
 
-#include "mfcc/PlatformMath.hpp"
 #include "mfcc/MicroNetKwsModel.hpp"
 #include "BufAttributes.hpp"
 
@@ -12,21 +11,40 @@ LOG_MODULE_REGISTER(KWSModel);
 // these can be move into the class, but then these must be allocated dynamically
 static uint8_t tensorArena[CONFIG_ACTIVATION_BUF_SZ] ACTIVATION_BUF_ATTRIBUTE;
 
-// Full 1 second sample buffer
+// Full 1 second sample buffer, made of two half second strides. Each new stride is captured
+// over the oldest one, which the previous inference no longer needs.
 static int16_t audio_inf[CONFIG_I2S_SAMPLE_RATE];
+static AudioRingBuffer<int16_t> audioRing(audio_inf, CONFIG_I2S_SAMPLE_RATE);
 
-static const char *labelsVec[] LABELS_ATTRIBUTE = {
+static const char *labelsVec[KWSModel::Result::NumLabels] LABELS_ATTRIBUTE = {
 	"down",  "go",   "left", "no",  "off",       "on",
 	"right", "stop", "up",   "yes", "_silence_", "_unknown_",
 };
 
 namespace arm::app::kws
 {
-extern uint8_t *GetModelPointer();
+extern const uint8_t *GetModelPointer();
 extern const int g_FrameLength;
 extern const int g_FrameStride;
 } // namespace arm::app::kws
 
+#if defined(CONFIG_KWS_VAD)
+static void PrintVadStats(const VoiceActivityDetector::Stats &stats)
+{
+	const uint32_t skipped = stats.blocks - stats.activeBlocks;
+	const uint32_t meanLatency =
+		stats.onsets ? static_cast<uint32_t>(stats.onsetLatencySum / stats.onsets) : 0;
+
+	LOG_INF("VAD: %" PRIu32 " of %" PRIu32 " strides skipped (%" PRIu32 "%%), %" PRIu32
+		" onsets",
+		skipped, stats.blocks, stats.blocks ? skipped * 100 / stats.blocks : 0,
+		stats.onsets);
+	LOG_INF("VAD: onset latency mean %" PRIu32 " ms, max %" PRIu32 " ms",
+		meanLatency * 1000 / CONFIG_I2S_SAMPLE_RATE,
+		stats.onsetLatencyMax * 1000 / CONFIG_I2S_SAMPLE_RATE);
+}
+#endif
+
 const char *KWSModel::Result::GetLabelName(size_t index)
 {
 	return labelsVec[index];
@@ -34,11 +52,26 @@ const char *KWSModel::Result::GetLabelName(size_t index)
 
 bool KWSModel::Init()
 {
+#if defined(CONFIG_ARM_ETHOS_U)
 	m_resolver.AddEthosU();
-
+#else
+	m_resolver.AddReshape();
+	m_resolver.AddAveragePool2D();
+	m_resolver.AddConv2D();
+	m_resolver.AddDepthwiseConv2D();
+	m_resolver.AddFullyConnected();
+	m_resolver.AddRelu();
+#endif
+
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+	m_pInterpreter = std::make_unique<tflite::MicroInterpreter>(
+		tflite::GetModel(arm::app::kws::GetModelPointer()), m_resolver, tensorArena,
+		CONFIG_ACTIVATION_BUF_SZ, nullptr, &m_profiler);
+#else
 	m_pInterpreter = std::make_unique<tflite::MicroInterpreter>(
 		tflite::GetModel(arm::app::kws::GetModelPointer()), m_resolver, tensorArena,
 		CONFIG_ACTIVATION_BUF_SZ);
+#endif
 
 	const auto rc = m_pInterpreter->AllocateTensors();
 	if (rc != kTfLiteOk) {
@@ -47,70 +80,130 @@ bool KWSModel::Init()
 	}
 
 	auto *inputTensor = m_pInterpreter->input(0);
+	if (inputTensor->bytes != FeatureSize) {
+		LOG_ERR("Unexpected input tensor size: %u", inputTensor->bytes);
+		return false;
+	}
+
 	size_t numMfccFeatures =
 		inputTensor->dims->data[arm::app::MicroNetKwsModel::ms_inputColsIdx];
 	size_t numMfccFrames = inputTensor->dims->data[arm::app::MicroNetKwsModel::ms_inputRowsIdx];
 	int mfccFrameLength = arm::app::kws::g_FrameLength;
 	int mfccFrameStride = arm::app::kws::g_FrameStride;
 
-	m_preProcess = std::make_unique<arm::app::KwsPreProcess>(
-		inputTensor, numMfccFeatures, numMfccFrames, mfccFrameLength, mfccFrameStride);
+	m_featureTensor = *inputTensor;
+
+	m_preProcess = std::make_unique<arm::app::KwsStreamingPreProcess>(
+		&m_featureTensor, numMfccFeatures, numMfccFrames, mfccFrameLength, mfccFrameStride);
+
+#if defined(CONFIG_KWS_VAD)
+	// 20 ms analysis frames
+	VoiceActivityDetector::Config vadConfig;
+	vadConfig.frameLength = CONFIG_I2S_SAMPLE_RATE / 50;
+	vadConfig.snrDb = CONFIG_KWS_VAD_SNR_DB;
+	vadConfig.hangoverFrames = CONFIG_KWS_VAD_HANGOVER_MS / 20;
+	m_vad = VoiceActivityDetector(vadConfig);
+#endif
 
 	return true;
 }
 
 bool KWSModel::PreProcess()
 {
-	if (!m_preProcess->DoPreProcess(audio_inf, m_index)) {
+	return PreProcess(m_pInterpreter->input(0)->data.data);
+}
+
+bool KWSModel::PreProcess(void *features)
+{
+	m_featureTensor.data.data = features;
+
+#if defined(CONFIG_KWS_VAD)
+	m_voiceActive = m_vad.Process(audioRing.GetWritePointer(), CONFIG_I2S_SAMPLE_RATE / 2);
+#endif
+
+	// slide the window onto the stride just captured, no audio is moved
+	audioRing.Commit(CONFIG_I2S_SAMPLE_RATE / 2);
+
+#if defined(CONFIG_KWS_VAD)
+	if (!m_voiceActive) {
+		if (!m_featuresStale) {
+			PrintVadStats(m_vad.GetStats());
+		}
+		m_featuresStale = true;
+		return true;
+	}
+
+	// the features of the skipped strides were not computed
+	if (m_featuresStale) {
+		m_preProcess->Reset();
+		m_featuresStale = false;
+	}
+#endif
+
+	// only the features of the new half second are computed
+	if (!m_preProcess->DoPreProcess(audioRing.GetWindow(CONFIG_I2S_SAMPLE_RATE),
+					CONFIG_I2S_SAMPLE_RATE / 2)) {
 		LOG_ERR("DoPreProcess failed");
 		return false;
 	}
 
-	++m_index;
+	return true;
+}
 
-	// move buffer down by one stride, clearing space at the end for the next stride
-	std::copy(audio_inf + (CONFIG_I2S_SAMPLE_RATE / 2), audio_inf + CONFIG_I2S_SAMPLE_RATE,
-		  audio_inf);
+bool KWSModel::RunInference(const void *features)
+{
+	std::copy_n(static_cast<const int8_t *>(features), FeatureSize,
+		    m_pInterpreter->input(0)->data.int8);
 
-	return true;
+	return RunInference();
 }
 
 bool KWSModel::RunInference()
 {
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+	m_profiler.reset();
+#endif
+
 	const auto rc = m_pInterpreter->Invoke();
 	if (rc != kTfLiteOk) {
 		LOG_ERR("Invoke failed: %i", rc);
 		return false;
 	}
 
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+	m_profiler.print();
+#endif
+
 	return true;
 }
 
 bool KWSModel::PostProcess()
 {
-	m_output.confidences.clear();
-
 	const auto *tensor = m_pInterpreter->output(0);
 
-	// int8 dequantize, does not work if per-axis quantization is used.
-	for (size_t i = 0; i < tensor->bytes; i++) {
-		float value = tensor->params.scale * (static_cast<float>(tensor->data.int8[i]) -
-						      tensor->params.zero_point);
-		m_output.confidences.push_back(value);
-	}
-
-	arm::app::math::MathUtils::SoftmaxF32(m_output.confidences);
+	// Rank on the int8 logits, only the reported scores are computed in float.
+	// Does not work if per-axis quantization is used.
+	m_classifier.Init(tensor->params.scale, tensor->params.zero_point);
+	m_output.count = m_classifier.GetTopN(tensor->data.int8, tensor->bytes, m_output.top,
+					      Result::NumTopResults, true);
 
-	return true;
+	return m_output.count > 0;
 }
 
 void *KWSModel::GetInputBuffer()
 {
-	// Fill input data to last stride in the buffer
-	return &audio_inf[CONFIG_I2S_SAMPLE_RATE / 2];
+	// Fill input data over the oldest stride in the buffer
+	return audioRing.GetWritePointer();
+}
+
+#if defined(CONFIG_KWS_VAD)
+bool KWSModel::IsInferenceNeeded()
+{
+	return m_voiceActive;
 }
+#endif
 
-KWSModel::Result KWSModel::GetResult()
+const KWSModel::Result &KWSModel::GetResult()
 {
 	return m_output;
 }
@@ -2,39 +2,80 @@
 #define KWSMODEL_H
 
 #include <memory>
-#include <vector>
 
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
 
+#include "ethosu/Int8Classifier.h"
+#if defined(CONFIG_KWS_VAD)
+#include "ethosu/VoiceActivityDetector.h"
+#endif
 #include "mfcc/KwsProcessing.hpp"
 
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+#include "layer_profiler.hpp"
+#endif
+
 class KWSModel
 {
 public:
 	class Result
 	{
 		public:
-		std::vector<float> confidences;
+		/* Highest scoring classes, highest first */
+		static constexpr size_t NumTopResults = 3;
+		static constexpr size_t NumLabels = 12;
+		Int8Classifier::Result top[NumTopResults];
+		size_t count = 0;
 		static const char *GetLabelName(size_t index);
 	};
 
 	/* Input buffer size in bytes (0.5 second of audio samples) */
 	static constexpr size_t InputSize = (CONFIG_I2S_SAMPLE_RATE / 2) * sizeof(int16_t);
 
+	/* MFCC features of one inference (49 frames of 10 int8 coefficients) */
+	static constexpr size_t NumMfccFrames = 49;
+	static constexpr size_t NumMfccFeatures = 10;
+	static constexpr size_t FeatureSize = NumMfccFrames * NumMfccFeatures * sizeof(int8_t);
+
 	bool Init(void);
 	bool PreProcess(void);
 	bool RunInference(void);
 	bool PostProcess(void);
 	void *GetInputBuffer(void);
-	Result GetResult(void);
+	const Result &GetResult(void);
+
+	/* PipelinedInferenceRunner interface */
+	bool PreProcess(void *features);
+	bool RunInference(const void *features);
+
+#if defined(CONFIG_KWS_VAD)
+	/* Inference runner gate, false when there was no voice in the last stride */
+	bool IsInferenceNeeded(void);
+#endif
 
 private:
 	std::unique_ptr<tflite::MicroInterpreter> m_pInterpreter;
-	std::unique_ptr<arm::app::KwsPreProcess> m_preProcess;
+	std::unique_ptr<arm::app::KwsStreamingPreProcess> m_preProcess;
+	/* Copy of the input tensor, redirected to the buffer being preprocessed */
+	TfLiteTensor m_featureTensor;
+#if defined(CONFIG_ARM_ETHOS_U)
 	tflite::MicroMutableOpResolver<1> m_resolver;
-	int m_index = 0;
+#else
+	/* Operators of the model before Vela compilation, on the reference kernels */
+	tflite::MicroMutableOpResolver<6> m_resolver;
+#endif
+	Int8Classifier m_classifier;
 	Result m_output;
+#if defined(CONFIG_KWS_VAD)
+	VoiceActivityDetector m_vad;
+	bool m_voiceActive = false;
+	/* Set while strides are skipped, the streaming features must then be recomputed */
+	bool m_featuresStale = true;
+#endif
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+	InferenceProcess::LayerProfiler m_profiler;
+#endif
 };
 
 #endif
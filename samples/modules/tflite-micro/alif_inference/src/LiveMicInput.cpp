@@ -4,12 +4,15 @@
 #include <zephyr/drivers/i2s.h>
 
 #include "LiveMicInput.h"
+#include "ethosu/AudioDownmix.h"
 
 LOG_MODULE_REGISTER(LiveMicInput);
 
 BUILD_ASSERT(LiveMicInput::OutputSize % CONFIG_I2S_SAMPLES == 0,
 	     "LiveMicInput::OutputSize must be a multiple of CONFIG_I2S_SAMPLES");
 BUILD_ASSERT(CONFIG_I2S_SAMPLES % 4 == 0, "CONFIG_I2S_SAMPLES must be a multiple of 4");
+BUILD_ASSERT(CONFIG_I2S_CHANNELS == 1 || CONFIG_I2S_CHANNELS == 2,
+	     "CONFIG_I2S_CHANNELS must be 1 or 2");
 
 #define I2S_DEVICE      DT_ALIAS(i2s_mic)
 #define I2S_SAMPLE_SIZE sizeof(int16_t)
@@ -24,25 +27,6 @@ BUILD_ASSERT(CONFIG_I2S_SAMPLES % 4 == 0, "CONFIG_I2S_SAMPLES must be a multiple
 K_MEM_SLAB_DEFINE_STATIC(mem_slab, I2S_BUFFER_SIZE, I2S_NUM_BUFFERS, 4);
 static const struct device *i2s_mic = DEVICE_DT_GET(I2S_DEVICE);
 
-static int i2s_mix_mono_output(int16_t *in, size_t in_size, int16_t *out, size_t out_size)
-{
-	size_t num_samples = in_size / 2;
-
-	if (out_size < num_samples) {
-		return -EINVAL;
-	}
-
-	for (size_t i = 0; i < num_samples; ++i) {
-		int16_t left_channel = in[2 * i];
-		int16_t right_channel = in[2 * i + 1];
-
-		out[i] = static_cast<int16_t>((left_channel + right_channel) / 2);
-		out[i] *= I2S_GAIN;
-	}
-
-	return 0;
-}
-
 bool LiveMicInput::Start()
 {
 	if (!device_is_ready(i2s_mic)) {
@@ -95,28 +79,35 @@ bool LiveMicInput::GetInputData(void *buffer)
 	size_t offset = 0;
 
 	int16_t *output_buffer = static_cast<int16_t *>(buffer);
+	const size_t output_samples = OutputSize / sizeof(int16_t);
 
-	while (OutputSize > offset) {
+	// Each DMA block goes straight to its place in the caller's buffer (the audio ring),
+	// downmixed and scaled in the same pass
+	while (output_samples > offset) {
 		int rc = i2s_read(i2s_mic, &slab, &slab_size);
 		if (rc != 0) {
 			LOG_ERR("i2s read failed: %i", rc);
 			return false;
 		}
 
-		int stereo_samples = slab_size / I2S_SAMPLE_SIZE;
+		const size_t frames = slab_size / (I2S_CHANNELS * I2S_SAMPLE_SIZE);
 
-		rc = i2s_mix_mono_output(static_cast<int16_t *>(slab), stereo_samples,
-					 output_buffer + offset / sizeof(int16_t),
-					 OutputSize - offset);
-
-		if (rc < 0) {
+		if (frames > output_samples - offset) {
 			k_mem_slab_free(&mem_slab, slab);
-			LOG_ERR("i2s_mix_mono_output failed: %i", rc);
+			LOG_ERR("i2s block of %zu frames overflows the input buffer", frames);
 			return false;
 		}
 
+#if I2S_CHANNELS == 2
+		AudioDownmixStereo(static_cast<const int16_t *>(slab), output_buffer + offset, frames,
+				   I2S_GAIN);
+#else
+		AudioApplyGain(static_cast<const int16_t *>(slab), output_buffer + offset, frames,
+			       I2S_GAIN);
+#endif
+
 		k_mem_slab_free(&mem_slab, slab);
-		offset += (stereo_samples / 2) * sizeof(int16_t); // In bytes
+		offset += frames;
 	}
 
 	return true;
@@ -0,0 +1,55 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include <errno.h>
+#include <zephyr/logging/log.h>
+
+#include "AudioBackend.hpp"
+#include "LiveMicInput.h"
+
+LOG_MODULE_REGISTER(WavMicInput);
+
+/* Host build LiveMicInput: strides are read from the WAV clips of the clip list, see
+ * WavAudioBackend.hpp, instead of the I2S microphone */
+
+bool LiveMicInput::Start()
+{
+	const int rc = audio_init(CONFIG_I2S_SAMPLE_RATE);
+
+	if (rc != 0) {
+		LOG_ERR("audio_init failed: %i", rc);
+		return false;
+	}
+
+	return true;
+}
+
+bool LiveMicInput::Stop()
+{
+	audio_uninit();
+
+	return true;
+}
+
+bool LiveMicInput::GetInputData(void *buffer)
+{
+	get_audio_data(static_cast<int16_t *>(buffer), OutputSize / sizeof(int16_t));
+
+	const int rc = wait_for_audio();
+
+	if (rc == -ENODATA) {
+		LOG_INF("End of the audio input");
+		return false;
+	} else if (rc != 0) {
+		LOG_ERR("WAV read failed: %i", rc);
+		return false;
+	}
+
+	return true;
+}
@@ -1,13 +1,15 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 
-#include <algorithm>
-#include <limits>
-#include <vector>
-
 #include "KWSModel.h"
 #include "LiveMicInput.h"
 #include "ethosu/InferenceRunner.h"
+#include "ethosu/PipelinedInferenceRunner.h"
+
+#if defined(CONFIG_KWS_WAV_INPUT)
+#include "Evaluation.h"
+#include "HostOptions.h"
+#endif
 
 LOG_MODULE_REGISTER(main);
 
@@ -17,18 +19,29 @@ class PrintHighestConfidence
 public:
 	void ProcessOutput(const T &result)
 	{
-		const auto it =
-			std::max_element(result.confidences.begin(), result.confidences.end());
-		const auto highest_idx = std::distance(result.confidences.begin(), it);
+		const auto &highest = result.top[0];
 
-		LOG_INF("%s: %f", T::Result::GetLabelName(highest_idx),
-			static_cast<double>(result.confidences[highest_idx]));
+		LOG_INF("%s: %f", T::GetLabelName(highest.index),
+			static_cast<double>(highest.score));
 	}
 };
 
 int main()
 {
+#if defined(CONFIG_KWS_WAV_INPUT)
+	/* Host build: evaluate the clips once, the exit status tells whether it passed */
+	kws_host_exit(EvaluateClips() ? 0 : 1);
+#endif
+
+#if defined(CONFIG_INFERENCE_PIPELINED)
+	PipelinedInferenceRunner<KWSModel, LiveMicInput, PrintHighestConfidence<KWSModel::Result>,
+				 IS_ENABLED(CONFIG_INFERENCE_PIPELINE_DROP_OLDEST)
+					 ? PipelinePolicy::DropOldest
+					 : PipelinePolicy::BackPressure>
+		runner;
+#else
 	InferenceRunner<KWSModel, LiveMicInput, PrintHighestConfidence<KWSModel::Result>> runner;
+#endif
 
 	runner.Start();
 
@@ -18,18 +18,18 @@
 #define CLASSIFICATION_RESULT_HPP
 
 #include <cstdint>
-#include <string>
 
 namespace arm {
 namespace app {
 
     /**
-     * @brief   Class representing a single classification result.
+     * @brief   Class representing a single classification result. The label is
+     *          referenced by its index in the labels vector, results are copied
+     *          without allocating.
      */
     class ClassificationResult {
     public:
         double          m_normalisedVal = 0.0;
-        std::string     m_label;
         uint32_t        m_labelIdx = 0;
 
         ClassificationResult() = default;
@@ -20,6 +20,7 @@
 #include "ClassificationResult.hpp"
 #include "TensorFlowLiteMicro.hpp"
 #include "Classifier.hpp"
+#include "ethosu/ScoreAverager.h"
 
 #include <vector>
 
@@ -33,6 +34,11 @@ namespace app {
      **/
     class KwsClassifier : public Classifier {
     public:
+        /* Capacity of the averaging window, MicroNet models have 12 classes. */
+        static constexpr size_t ms_maxClasses = 16;
+        static constexpr size_t ms_maxAveragingWindowLen = 8;
+
+        using ResultHistory = ScoreAverager<ms_maxClasses, ms_maxAveragingWindowLen>;
 
         /**
          * @brief           Gets the top N classification results from the
@@ -44,20 +50,13 @@ namespace app {
          * @param[in]       topNCount      Number of top classifications to pick. Default is 1.
          * @param[in]       useSoftmax     Whether Softmax normalisation should be applied to output. Default is false.
          * @param[in/out]   resultHistory  History of previous classification results to be updated.
+         *                                 With a window of 1 or less, results are not averaged.
          * @return          true if successful, false otherwise.
          **/
          using Classifier::GetClassificationResults;  /* We are overloading not overriding. */
          bool GetClassificationResults(TfLiteTensor* outputTensor, std::vector<ClassificationResult>& vecResults,
                  const std::vector <std::string>& labels, uint32_t topNCount,
-                 bool use_softmax, std::vector<std::vector<float>>& resultHistory);
-
-        /**
-         * @brief        Average the given history of results.
-         * @param[in]    resultHistory   The history of results to take on average of.
-         * @param[out]   averageResult   The calculated average.
-         **/
-         static void AveragResults(const std::vector<std::vector<float>>& resultHistory,
-                 std::vector<float>& averageResult);
+                 bool use_softmax, ResultHistory& resultHistory);
     };
 
 } /* namespace app */
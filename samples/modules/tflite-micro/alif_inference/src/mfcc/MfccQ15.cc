@@ -0,0 +1,284 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "MfccQ15.hpp"
+#include "PlatformMath.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(MfccQ15);
+
+namespace arm
+{
+namespace app
+{
+namespace audio
+{
+
+namespace
+{
+/* logf(FLT_MIN) in Q16, the float path mel energies of a silent frame. */
+constexpr int32_t logFltMinQ16 = -5723735;
+
+/* ln(2) in Q30. */
+constexpr int64_t ln2Q30 = 744261118;
+
+/* Q2.14 magnitudes times Q15 weights. */
+constexpr int32_t melEnergyFracBits = 29;
+
+int16_t ToQ15(float value)
+{
+	const long q = lroundf(value * 32768.0f);
+
+	return static_cast<int16_t>(std::min<long>(std::max<long>(q, INT16_MIN), INT16_MAX));
+}
+} /* namespace */
+
+MfccQ15::MfccQ15(const MfccParams &params) : m_params(params)
+{
+}
+
+bool MfccQ15::Init()
+{
+	if (this->m_initialised) {
+		return true;
+	}
+
+	const uint32_t fftLen = this->m_params.m_frameLenPadded;
+	const uint32_t numFftBins = fftLen / 2;
+	const uint32_t numBanks = this->m_params.m_numFbankBins;
+	const uint32_t numFeatures = this->m_params.m_numMfccFeatures;
+	const uint32_t frameLen = this->m_params.m_frameLen;
+
+	if (fftLen > ms_maxFrameLenPadded || numBanks > ms_maxNumFbankBins ||
+	    numFeatures > ms_maxNumMfccFeatures) {
+		LOG_ERR("MFCC parameters exceed the fixed-point limits");
+		return false;
+	}
+
+	if (!math::MathUtils::FftInitQ15(fftLen, this->m_fftInstance)) {
+		return false;
+	}
+
+	this->m_log2FftLen = 0;
+	while ((1u << this->m_log2FftLen) < fftLen) {
+		this->m_log2FftLen++;
+	}
+
+	/* Window function, as MFCC. */
+	const auto multiplier = static_cast<float>(2 * M_PI / frameLen);
+	for (uint32_t i = 0; i < frameLen; i++) {
+		this->m_windowFunc[i] = ToQ15(
+			0.5f - 0.5f * math::MathUtils::CosineF32(static_cast<float>(i) * multiplier));
+	}
+
+	/* Mel filter bank, same bin ranges as MFCC::CreateMelFilterBank. */
+	const float fftBinWidth = this->m_params.m_samplingFreq / fftLen;
+	const bool useHtk = this->m_params.m_useHtkMethod;
+	const float melLowFreq = MFCC::MelScale(this->m_params.m_melLoFreq, useHtk);
+	const float melHighFreq = MFCC::MelScale(this->m_params.m_melHiFreq, useHtk);
+	const float melFreqDelta = (melHighFreq - melLowFreq) / (numBanks + 1);
+	uint32_t numWeights = 0;
+
+	for (uint32_t bin = 0; bin < numBanks; bin++) {
+		const float leftMel = melLowFreq + bin * melFreqDelta;
+		const float centerMel = melLowFreq + (bin + 1) * melFreqDelta;
+		const float rightMel = melLowFreq + (bin + 2) * melFreqDelta;
+		bool firstIndexFound = false;
+
+		this->m_filterBankFilterFirst[bin] = 0;
+		this->m_filterBankFilterLast[bin] = 0;
+		this->m_filterBankWeightsOffset[bin] = numWeights;
+
+		for (uint32_t i = 0; i < numFftBins; i++) {
+			const float mel = MFCC::MelScale(fftBinWidth * i, useHtk);
+
+			if (mel <= leftMel || mel >= rightMel) {
+				continue;
+			}
+
+			if (numWeights == ms_maxFrameLenPadded) {
+				LOG_ERR("Too many mel filter bank weights");
+				return false;
+			}
+
+			const float weight = mel <= centerMel
+						     ? (mel - leftMel) / (centerMel - leftMel)
+						     : (rightMel - mel) / (rightMel - centerMel);
+
+			if (!firstIndexFound) {
+				this->m_filterBankFilterFirst[bin] = i;
+				firstIndexFound = true;
+			}
+			this->m_filterBankFilterLast[bin] = i;
+
+			/* Bins are contiguous, weights of a bank follow each other. */
+			this->m_melWeights[numWeights++] = ToQ15(weight);
+		}
+
+		if (!firstIndexFound) {
+			if (numWeights == ms_maxFrameLenPadded) {
+				LOG_ERR("Too many mel filter bank weights");
+				return false;
+			}
+
+			/* Empty bank, as in MFCC it reads FFT bin 0 with no weight. */
+			this->m_melWeights[numWeights++] = 0;
+		}
+	}
+
+	/* DCT matrix, as MFCC::CreateDCTMatrix. */
+	const float normaliser = math::MathUtils::SqrtF32(2.0f / numBanks);
+	const auto angleIncr = static_cast<float>(M_PI / numBanks);
+	float angle = 0;
+
+	for (uint32_t k = 0; k < numFeatures; k++) {
+		for (uint32_t n = 0; n < numBanks; n++) {
+			this->m_dctMatrix[k * numBanks + n] =
+				ToQ15(normaliser * math::MathUtils::CosineF32((n + 0.5f) * angle));
+		}
+		angle += angleIncr;
+	}
+
+	for (uint32_t i = 0; i <= (1u << ms_log2LutBits); i++) {
+		this->m_log2Lut[i] = static_cast<int32_t>(
+			lroundf(log2f(1.0f + static_cast<float>(i) / (1u << ms_log2LutBits)) * 65536));
+	}
+
+	this->m_initialised = true;
+
+	return true;
+}
+
+void MfccQ15::SetQuantisation(float quantScale, int quantOffset)
+{
+	this->m_quantMultiplier = llroundf(65536.0f / quantScale);
+	this->m_quantOffset = quantOffset;
+}
+
+int32_t MfccQ15::Log2(uint64_t value) const
+{
+	const int32_t msb = 63 - __builtin_clzll(value);
+
+	/* Bits below the leading one, left aligned on 32 bits. */
+	const auto frac = static_cast<uint32_t>(msb >= 32 ? value >> (msb - 32)
+							  : value << (32 - msb));
+	const uint32_t index = frac >> (32 - ms_log2LutBits);
+	const uint32_t rest = frac & ((1u << (32 - ms_log2LutBits)) - 1);
+	const int32_t lo = this->m_log2Lut[index];
+	const int32_t hi = this->m_log2Lut[index + 1];
+
+	return (msb << 16) +
+	       lo + static_cast<int32_t>((static_cast<int64_t>(hi - lo) * rest) >>
+					 (32 - ms_log2LutBits));
+}
+
+void MfccQ15::ComputeLogMelEnergies(const int16_t *audioData)
+{
+	const uint32_t frameLen = this->m_params.m_frameLen;
+	const uint32_t fftLen = this->m_params.m_frameLenPadded;
+
+	/* Windowed samples are Q30, keep as many bits as fit in Q15 (block floating point). */
+	int32_t maxAbs = 0;
+	for (uint32_t i = 0; i < frameLen; i++) {
+		maxAbs = std::max(maxAbs, std::abs(audioData[i] * this->m_windowFunc[i]));
+	}
+
+	int32_t shift = 0;
+	while (shift < 15 && (maxAbs >> (14 - shift)) <= INT16_MAX) {
+		shift++;
+	}
+
+	/* A full-scale positive sample rounds up to 32768, saturate it. */
+	const int32_t rounding = shift < 15 ? 1 << (14 - shift) : 0;
+	for (uint32_t i = 0; i < frameLen; i++) {
+		this->m_frame[i] = static_cast<int16_t>(std::min<int32_t>(
+			(audioData[i] * this->m_windowFunc[i] + rounding) >> (15 - shift),
+			INT16_MAX));
+	}
+	std::fill(this->m_frame + frameLen, this->m_frame + fftLen, 0);
+
+	math::MathUtils::FftQ15(this->m_frame, this->m_fftOutput, this->m_fftInstance);
+	math::MathUtils::ComplexMagnitudeQ15(this->m_fftOutput, this->m_magnitudes, fftLen / 2);
+
+	/* Bin 0 is real, its imaginary slot may hold the Nyquist bin. */
+	this->m_magnitudes[0] = static_cast<int16_t>(std::abs(this->m_fftOutput[0]) >> 1);
+
+	/* The FFT scales down by fftLen and the frame was scaled up by 2^shift. */
+	const int32_t log2Scale = (this->m_log2FftLen - melEnergyFracBits - shift) * 65536;
+
+	for (uint32_t bin = 0; bin < this->m_params.m_numFbankBins; bin++) {
+		const int16_t *weights = this->m_melWeights + this->m_filterBankWeightsOffset[bin];
+		const uint32_t firstIndex = this->m_filterBankFilterFirst[bin];
+		const uint32_t lastIndex = this->m_filterBankFilterLast[bin];
+		uint64_t melEnergy = 0;
+
+		for (uint32_t i = firstIndex; i <= lastIndex; i++) {
+			melEnergy += static_cast<uint32_t>(*weights++ * this->m_magnitudes[i]);
+		}
+
+		if (maxAbs == 0) {
+			this->m_melEnergies[bin] = logFltMinQ16;
+			continue;
+		}
+
+		/* Energies below the Q15 resolution read as the smallest non-zero one. */
+		melEnergy = std::max<uint64_t>(melEnergy, 1);
+
+		const int64_t log2Energy = this->Log2(melEnergy) + log2Scale;
+		this->m_melEnergies[bin] =
+			static_cast<int32_t>((log2Energy * ln2Q30 + (1 << 29)) >> 30);
+	}
+}
+
+void MfccQ15::MfccCompute(const int16_t *audioData, int32_t *mfccOut)
+{
+	if (!this->Init()) {
+		std::fill(mfccOut, mfccOut + this->m_params.m_numMfccFeatures, 0);
+		return;
+	}
+
+	this->ComputeLogMelEnergies(audioData);
+
+	const uint32_t numBanks = this->m_params.m_numFbankBins;
+
+	/* Take DCT. Q15 coefficients times Q16 energies, back to Q16. */
+	for (uint32_t i = 0; i < this->m_params.m_numMfccFeatures; i++) {
+		const int16_t *dct = this->m_dctMatrix + i * numBanks;
+		int64_t sum = 0;
+
+		for (uint32_t j = 0; j < numBanks; j++) {
+			sum += static_cast<int64_t>(dct[j]) * this->m_melEnergies[j];
+		}
+
+		mfccOut[i] = static_cast<int32_t>((sum + (1 << 14)) >> 15);
+	}
+}
+
+void MfccQ15::MfccComputeQuant(const int16_t *audioData, int8_t *mfccOut)
+{
+	int32_t features[ms_maxNumMfccFeatures];
+
+	this->MfccCompute(audioData, features);
+
+	for (uint32_t i = 0; i < this->m_params.m_numMfccFeatures; i++) {
+		/* Q16 feature times Q16 inverse scale. */
+		int64_t q = (features[i] * this->m_quantMultiplier + (INT64_C(1) << 31)) >> 32;
+
+		q += this->m_quantOffset;
+		mfccOut[i] = static_cast<int8_t>(std::min<int64_t>(std::max<int64_t>(q, INT8_MIN),
+								    INT8_MAX));
+	}
+}
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
@@ -18,6 +18,7 @@
 #define KWS_MICRONET_MFCC_HPP
 
 #include "Mfcc.hpp"
+#include "MfccQ15.hpp"
 
 namespace arm {
 namespace app {
@@ -43,6 +44,22 @@ namespace audio {
         ~MicroNetKwsMFCC() = default;
     };
 
+    /* Fixed-point MFCC with the MicroNet parameters. */
+    class MicroNetKwsMfccQ15 : public MfccQ15 {
+
+    public:
+        explicit MicroNetKwsMfccQ15(const size_t numFeats, const size_t frameLen)
+            :  MfccQ15(MfccParams(
+                        MicroNetKwsMFCC::ms_defaultSamplingFreq,
+                        MicroNetKwsMFCC::ms_defaultNumFbankBins,
+                        MicroNetKwsMFCC::ms_defaultMelLoFreq,
+                        MicroNetKwsMFCC::ms_defaultMelHiFreq,
+                        numFeats, frameLen, MicroNetKwsMFCC::ms_defaultUseHtkMethod))
+        {}
+        MicroNetKwsMfccQ15()  = delete;
+        ~MicroNetKwsMfccQ15() = default;
+    };
+
 } /* namespace audio */
 } /* namespace app */
 } /* namespace arm */
@@ -43,12 +43,27 @@ namespace math {
         arm_rfft_fast_instance_f32  m_instanceReal;
         arm_cfft_instance_f32       m_instanceComplex;
 #endif /* (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)) */
+        /* Portable FFT twiddle factors, cos and -sin of 2 * pi * k / m_fftLen,
+         * only built when the optimised option is not available. */
+        std::vector<float>          m_twiddles;
         uint16_t                    m_fftLen{0};
         FftType                     m_type{FftType::real};
         bool                        m_optimisedOptionAvailable{false};
         bool                        m_initialised{false};
     };
 
+    struct FftInstanceQ15 {
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+        arm_rfft_instance_q15       m_instance;
+#endif /* (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)) */
+        /* Portable FFT twiddle factors in Q15, cos and -sin of 2 * pi * k / m_fftLen,
+         * only built when the optimised option is not available. */
+        std::vector<int16_t>        m_twiddles;
+        uint16_t                    m_fftLen{0};
+        bool                        m_optimisedOptionAvailable{false};
+        bool                        m_initialised{false};
+    };
+
     /* Class to provide Math functions like FFT, mean, stddev etc.
      * This will allow other classes, functions to be independent of
      * #if definition checks and provide a cleaner API. Also, it will
@@ -110,7 +125,11 @@ namespace math {
                                FftType type = FftType::real);
 
         /**
-         * @brief       Computes the FFT for the input vector.
+         * @brief       Computes the FFT for the input vector. Without the optimised
+         *              option, power of 2 lengths use a portable radix-2 FFT and
+         *              other lengths a DFT. Real FFT output has the
+         *              arm_rfft_fast_f32 layout:
+         *              [real0, realN/2, real1, im1, ..., realN/2-1, imN/2-1].
          * @param[in]   input       Floating point vector of input elements
          * @param[out]  fftOutput   Output buffer to be populated by computed FFTs.
          * @param[in]   fftInstance FFT instance struct to use.
@@ -119,6 +138,36 @@ namespace math {
                            std::vector<float>& fftOutput,
                            FftInstance& fftInstance);
 
+        /**
+         * @brief       Initialises a Q15 real FFT instance.
+         * @param[in]   fftLen        Requested length of the FFT, a power of 2.
+         * @param[in]   fftInstance   FFT instance struct to use.
+         * @return      true if successful, false otherwise.
+         */
+        static bool FftInitQ15(uint16_t fftLen, FftInstanceQ15& fftInstance);
+
+        /**
+         * @brief       Computes the real FFT of Q15 samples. As with CMSIS-DSP
+         *              arm_rfft_q15, the output is scaled down by the FFT length
+         *              to avoid overflows.
+         * @param[in]   input       fftLen Q15 samples, may be used as scratch.
+         * @param[out]  fftOutput   2 x fftLen Q15 values, bin k real and imaginary
+         *                          parts at [2k] and [2k + 1] for k < fftLen / 2.
+         *                          The imaginary part of bin 0 is not meaningful.
+         * @param[in]   fftInstance FFT instance struct to use.
+         */
+        static void FftQ15(int16_t* input, int16_t* fftOutput,
+                           FftInstanceQ15& fftInstance);
+
+        /**
+         * @brief       Computes the magnitude of Q15 complex numbers.
+         * @param[in]   ptrSrc       Interleaved real and imaginary parts.
+         * @param[out]  ptrDst       Magnitudes in Q2.14.
+         * @param[in]   numSamples   Number of complex numbers.
+         */
+        static void ComplexMagnitudeQ15(const int16_t* ptrSrc, int16_t* ptrDst,
+                                        uint32_t numSamples);
+
         /**
          * @brief       Computes the natural logarithms of input floating point
          *              vector
@@ -165,6 +214,13 @@ namespace math {
         */
         static void SoftmaxF32(std::vector<float>& vec);
 
+        /**
+        * @brief       Softmax of an array of scores, in-place.
+        * @param[in]   ptrSrc   Pointer to the first element.
+        * @param[in]   srcLen   Number of elements in the array.
+        */
+        static void SoftmaxF32(float* ptrSrc, uint32_t srcLen);
+
         /**
         * @brief       Calculate the Sigmoid function of the given value.
         * @param[in]   x   Value to apply Sigmoid to.
@@ -0,0 +1,84 @@
+# Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+# Use, distribution and modification of this code is permitted under the
+# terms stated in the Alif Semiconductor Software License Agreement
+#
+# You should have received a copy of the Alif Semiconductor Software
+# License Agreement with this file. If not, please write to:
+# contact@alifsemi.com, or visit: https://alifsemi.com/license
+
+# Evaluation data of the KWS host builds (CONFIG_KWS_EVAL_FETCH_DATA): the int8 MicroNet model
+# and a labelled clip set, downloaded once into the build directory and checked against their
+# SHA-256 digests. The model and the clip list become the defaults of the -kws_model and
+# -kws_clips options of the target.
+
+function(kws_download url sha256 file)
+  if(sha256 STREQUAL "")
+    message(FATAL_ERROR "No SHA-256 given to check the download of ${url}")
+  endif()
+
+  message(STATUS "Downloading ${url}")
+
+  # On a digest mismatch, CMake fails the configuration and the file stays a .part
+  file(DOWNLOAD ${url} ${file}.part EXPECTED_HASH SHA256=${sha256} STATUS status)
+  list(GET status 0 code)
+
+  if(NOT code EQUAL 0)
+    file(REMOVE ${file}.part)
+    list(GET status 1 reason)
+    message(FATAL_ERROR "Cannot download ${url}: ${reason}")
+  endif()
+
+  file(RENAME ${file}.part ${file})
+endfunction()
+
+function(kws_fetch_eval_data target)
+  set(dir ${CMAKE_BINARY_DIR}/kws_eval)
+  set(model ${dir}/kws_micronet_m.tflite)
+  set(clips ${dir}/clips)
+  set(clip_list ${dir}/clip_list.txt)
+
+  if(NOT EXISTS ${model})
+    kws_download(${CONFIG_KWS_EVAL_MODEL_URL} "${CONFIG_KWS_EVAL_MODEL_SHA256}" ${model})
+  endif()
+
+  # Extracted aside first, an interrupted build downloads the clips again
+  if(NOT EXISTS ${clips})
+    kws_download(${CONFIG_KWS_EVAL_CLIPS_URL} "${CONFIG_KWS_EVAL_CLIPS_SHA256}"
+                 ${dir}/clips.tar.gz)
+    file(ARCHIVE_EXTRACT INPUT ${dir}/clips.tar.gz DESTINATION ${clips}.part)
+    file(REMOVE ${dir}/clips.tar.gz)
+    file(RENAME ${clips}.part ${clips})
+  endif()
+
+  # One directory per label, the first clips of each in name order
+  file(GLOB labels LIST_DIRECTORIES true RELATIVE ${clips} ${clips}/*)
+  set(lines "")
+
+  foreach(label ${labels})
+    if(NOT IS_DIRECTORY ${clips}/${label})
+      continue()
+    endif()
+
+    file(GLOB wavs RELATIVE ${clips} ${clips}/${label}/*.wav)
+    list(LENGTH wavs count)
+
+    if(count GREATER CONFIG_KWS_EVAL_CLIPS_PER_LABEL)
+      list(SUBLIST wavs 0 ${CONFIG_KWS_EVAL_CLIPS_PER_LABEL} wavs)
+    endif()
+
+    foreach(wav ${wavs})
+      string(APPEND lines "clips/${wav}\n")
+    endforeach()
+  endforeach()
+
+  if(lines STREQUAL "")
+    message(FATAL_ERROR "No labelled WAV clip in ${CONFIG_KWS_EVAL_CLIPS_URL}")
+  endif()
+
+  file(WRITE ${clip_list} "${lines}")
+
+  target_compile_definitions(${target} PRIVATE
+    KWS_EVAL_MODEL_FILE="${model}"
+    KWS_EVAL_CLIP_LIST="${clip_list}"
+  )
+endfunction()
@@ -19,6 +19,7 @@
 
 #include "ClassificationResult.hpp"
 #include "TensorFlowLiteMicro.hpp"
+#include "ethosu/Int8Classifier.h"
 
 #include <vector>
 
@@ -54,35 +55,41 @@ namespace app {
             const std::vector <std::string>& labels, uint32_t topNCount,
             bool use_softmax);
 
-        /**
-        * @brief       Populate the elements of the Classification Result object.
-        * @param[in]   topNSet        Ordered set of top 5 output class scores and labels.
-        * @param[out]  vecResults     A vector of classification results.
-        *                             populated by this function.
-        * @param[in]   labels         Labels vector to match classified classes.
-        **/
-
-        void SetVectorResults(
-            std::set<std::pair<float, uint32_t>>& topNSet,
-            std::vector<ClassificationResult>& vecResults,
-            const std::vector <std::string>& labels);
-
     protected:
         /**
          * @brief       Utility function that gets the top N classification results from the
-         *              output vector.
-         * @param[in]   tensor       Inference output tensor from an NN model.
+         *              output scores. Results reference the classes by label index.
+         * @param[in]   scores       Dequantised scores of each class.
+         * @param[in]   numClasses   Number of classes, the size of the labels vector.
          * @param[out]  vecResults   A vector of classification results
          *                           populated by this function.
          * @param[in]   topNCount    Number of top classifications to pick.
-         * @param[in]   labels       Labels vector to match classified classes.
          * @return      true if successful, false otherwise.
          **/
 
-        bool GetTopNResults(const std::vector<float>& tensor,
+        bool GetTopNResults(const float* scores, uint32_t numClasses,
                             std::vector<ClassificationResult>& vecResults,
-                            uint32_t topNCount,
-                            const std::vector <std::string>& labels);
+                            uint32_t topNCount);
+
+        /**
+         * @brief       Gets the top N classification results of an int8 output tensor
+         *              without dequantizing it. Ranking is done on the int8 values,
+         *              only the scores of the top N results are computed in float.
+         * @param[in]   outputTensor   Inference output tensor of type int8.
+         * @param[out]  vecResults     A vector of classification results
+         *                             populated by this function.
+         * @param[in]   labels         Labels vector to match classified classes.
+         * @param[in]   topNCount      Number of top classifications to pick.
+         * @param[in]   useSoftmax     Whether Softmax normalisation should be applied to output.
+         * @return      true if successful, false otherwise.
+         **/
+        bool GetInt8TopNResults(TfLiteTensor* outputTensor,
+                                std::vector<ClassificationResult>& vecResults,
+                                const std::vector <std::string>& labels, uint32_t topNCount,
+                                bool useSoftmax);
+
+        /* Dequantization and softmax tables of the int8 output tensor */
+        Int8Classifier m_int8Classifier;
     };
 
 } /* namespace app */
@@ -0,0 +1,116 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#ifndef MFCC_Q15_HPP
+#define MFCC_Q15_HPP
+
+#include "Mfcc.hpp"
+#include "PlatformMath.hpp"
+
+#include <cstdint>
+
+namespace arm {
+namespace app {
+namespace audio {
+
+    /**
+     * @brief   Fixed-point MFCC feature extraction, same features as MFCC.
+     *
+     *          All buffers are fixed-size members and every table (window, mel weights,
+     *          DCT, log2) is built once by Init(), the only place floating point is used.
+     *          Per frame:
+     *
+     *            Q15 windowed frame, normalised to full scale (block floating point)
+     *            -> Q15 real FFT -> Q2.14 magnitudes -> Q15 mel weights (64-bit sums)
+     *            -> log2 by lookup table -> Q16 log mel energies -> Q15 DCT -> Q16 MFCC
+     *
+     *          The mel filter bank is not normalised (as MFCC::GetMelFilterBankNormaliser).
+     */
+    class MfccQ15 {
+    public:
+        static constexpr uint32_t ms_maxFrameLenPadded = 1024;
+        static constexpr uint32_t ms_maxNumFbankBins = 64;
+        static constexpr uint32_t ms_maxNumMfccFeatures = 16;
+
+        /**
+         * @brief       Constructor
+         * @param[in]   params   MFCC parameters, within the ms_max* limits.
+         */
+        explicit MfccQ15(const MfccParams& params);
+
+        MfccQ15() = delete;
+
+        ~MfccQ15() = default;
+
+        /**
+         * @brief   Build the lookup tables.
+         * @return  true if successful, false if the parameters exceed the limits.
+         */
+        bool Init();
+
+        /**
+         * @brief       Set the quantisation used by MfccComputeQuant.
+         * @param[in]   quantScale    Quantisation scale.
+         * @param[in]   quantOffset   Quantisation offset.
+         */
+        void SetQuantisation(float quantScale, int quantOffset);
+
+        /**
+         * @brief       Extract MFCC features for one frame of audio data.
+         * @param[in]   audioData   m_frameLen audio samples.
+         * @param[out]  mfccOut     m_numMfccFeatures features in Q16.
+         */
+        void MfccCompute(const int16_t* audioData, int32_t* mfccOut);
+
+        /**
+         * @brief       Extract MFCC features for one frame of audio data and quantise
+         *              them with the SetQuantisation() parameters.
+         * @param[in]   audioData   m_frameLen audio samples.
+         * @param[out]  mfccOut     m_numMfccFeatures quantised features.
+         */
+        void MfccComputeQuant(const int16_t* audioData, int8_t* mfccOut);
+
+    private:
+        static constexpr uint32_t ms_log2LutBits = 8;
+
+        MfccParams                  m_params;
+        math::FftInstanceQ15        m_fftInstance;
+        bool                        m_initialised{false};
+
+        int16_t                     m_windowFunc[ms_maxFrameLenPadded];
+        int16_t                     m_frame[ms_maxFrameLenPadded];
+        int16_t                     m_fftOutput[2 * ms_maxFrameLenPadded];
+        int16_t                     m_magnitudes[ms_maxFrameLenPadded / 2];
+
+        /* Filter bank weights of all bins, concatenated, each FFT bin is in at most 2 bins. */
+        int16_t                     m_melWeights[ms_maxFrameLenPadded];
+        uint16_t                    m_filterBankFilterFirst[ms_maxNumFbankBins];
+        uint16_t                    m_filterBankFilterLast[ms_maxNumFbankBins];
+        uint16_t                    m_filterBankWeightsOffset[ms_maxNumFbankBins];
+
+        int16_t                     m_dctMatrix[ms_maxNumMfccFeatures * ms_maxNumFbankBins];
+        int32_t                     m_melEnergies[ms_maxNumFbankBins];  /* Q16 natural log. */
+        int32_t                     m_log2Lut[(1 << ms_log2LutBits) + 1];  /* Q16 log2(1 + x). */
+
+        int32_t                     m_log2FftLen{0};
+        int64_t                     m_quantMultiplier{0};  /* Q16 1 / scale. */
+        int32_t                     m_quantOffset{0};
+
+        /** @brief  Q16 log2 of a non-zero value. */
+        int32_t Log2(uint64_t value) const;
+
+        /** @brief  Compute the Q16 log mel energies of one frame. */
+        void ComputeLogMelEnergies(const int16_t* audioData);
+    };
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* MFCC_Q15_HPP */
@@ -21,7 +21,6 @@
 
 #include <vector>
 #include <string>
-#include <set>
 #include <cstdint>
 #include <cinttypes>
 #include <zephyr/logging/log.h>
@@ -33,49 +32,73 @@ namespace arm
 namespace app
 {
 
-void Classifier::SetVectorResults(std::set<std::pair<float, uint32_t>> &topNSet,
-				  std::vector<ClassificationResult> &vecResults,
-				  const std::vector<std::string> &labels)
+bool Classifier::GetTopNResults(const float *scores, uint32_t numClasses,
+				std::vector<ClassificationResult> &vecResults, uint32_t topNCount)
 {
-	/* Reset the iterator to the largest element - use reverse iterator. */
+	/* NOTE: inputVec's size verification against labels should be
+	 *       checked by the calling/public function. */
 
-	auto topNIter = topNSet.rbegin();
-	for (size_t i = 0; i < vecResults.size() && topNIter != topNSet.rend(); ++i, ++topNIter) {
-		vecResults[i].m_normalisedVal = topNIter->first;
-		vecResults[i].m_label = labels[topNIter->second];
-		vecResults[i].m_labelIdx = topNIter->second;
-	}
-}
+	/* Final results' container, highest value first. */
+	vecResults.resize(topNCount);
+	uint32_t filled = 0;
 
-bool Classifier::GetTopNResults(const std::vector<float> &tensor,
-				std::vector<ClassificationResult> &vecResults, uint32_t topNCount,
-				const std::vector<std::string> &labels)
-{
-	std::set<std::pair<float, uint32_t>> sortedSet;
+	for (uint32_t i = 0; i < numClasses; ++i) {
+		if (filled == topNCount && scores[i] <= vecResults[topNCount - 1].m_normalisedVal) {
+			continue;
+		}
 
-	/* NOTE: inputVec's size verification against labels should be
-	 *       checked by the calling/public function. */
+		/* Insert in order, dropping the lowest result when full. */
+		uint32_t pos = filled < topNCount ? filled++ : topNCount - 1;
+
+		while (pos > 0 && vecResults[pos - 1].m_normalisedVal < scores[i]) {
+			vecResults[pos] = vecResults[pos - 1];
+			pos--;
+		}
 
-	/* Set initial elements. */
-	for (uint32_t i = 0; i < topNCount; ++i) {
-		sortedSet.insert({tensor[i], i});
+		vecResults[pos].m_normalisedVal = scores[i];
+		vecResults[pos].m_labelIdx = i;
 	}
 
-	/* Initialise iterator. */
-	auto setFwdIter = sortedSet.begin();
+	return true;
+}
 
-	/* Scan through the rest of elements with compare operations. */
-	for (uint32_t i = topNCount; i < labels.size(); ++i) {
-		if (setFwdIter->first < tensor[i]) {
-			sortedSet.erase(*setFwdIter);
-			sortedSet.insert({tensor[i], i});
-			setFwdIter = sortedSet.begin();
+bool Classifier::GetInt8TopNResults(TfLiteTensor *outputTensor,
+				    std::vector<ClassificationResult> &vecResults,
+				    const std::vector<std::string> &labels, uint32_t topNCount,
+				    bool useSoftmax)
+{
+	/* KWS only reports the best few results, larger N is ranked in float below. */
+	constexpr size_t maxTopN = 8;
+	Int8Classifier::Result top[maxTopN];
+
+	const QuantParams quantParams = GetTensorQuantParams(outputTensor);
+	m_int8Classifier.Init(quantParams.scale, quantParams.offset);
+
+	if (topNCount > maxTopN) {
+		std::vector<float> tensorData(labels.size());
+
+		if (useSoftmax) {
+			m_int8Classifier.Softmax(tflite::GetTensorData<int8_t>(outputTensor),
+						 labels.size(), tensorData.data());
+		} else {
+			for (size_t i = 0; i < labels.size(); ++i) {
+				tensorData[i] = m_int8Classifier.Dequantize(
+					tflite::GetTensorData<int8_t>(outputTensor)[i]);
+			}
 		}
+
+		return GetTopNResults(tensorData.data(), labels.size(), vecResults, topNCount);
 	}
 
-	/* Final results' container. */
-	vecResults = std::vector<ClassificationResult>(topNCount);
-	SetVectorResults(sortedSet, vecResults, labels);
+	const size_t count =
+		m_int8Classifier.GetTopN(tflite::GetTensorData<int8_t>(outputTensor),
+					 labels.size(), top, topNCount, useSoftmax);
+
+	vecResults.resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		vecResults[i].m_normalisedVal = top[i].score;
+		vecResults[i].m_labelIdx = top[i].index;
+	}
 
 	return true;
 }
@@ -108,6 +131,11 @@ bool Classifier::GetClassificationResults(TfLiteTensor *outputTensor,
 	}
 
 	bool resultState;
+
+	if (outputTensor->type == kTfLiteInt8) {
+		return GetInt8TopNResults(outputTensor, vecResults, labels, topNCount, useSoftmax);
+	}
+
 	vecResults.clear();
 
 	/* De-Quantize Output Tensor */
@@ -128,14 +156,6 @@ bool Classifier::GetClassificationResults(TfLiteTensor *outputTensor,
 		}
 		break;
 	}
-	case kTfLiteInt8: {
-		int8_t *tensor_buffer = tflite::GetTensorData<int8_t>(outputTensor);
-		for (size_t i = 0; i < totalOutputSize; ++i) {
-			tensorData[i] = quantParams.scale *
-					(static_cast<float>(tensor_buffer[i]) - quantParams.offset);
-		}
-		break;
-	}
 	case kTfLiteFloat32: {
 		float *tensor_buffer = tflite::GetTensorData<float>(outputTensor);
 		for (size_t i = 0; i < totalOutputSize; ++i) {
@@ -154,7 +174,7 @@ bool Classifier::GetClassificationResults(TfLiteTensor *outputTensor,
 	}
 
 	/* Get the top N results. */
-	resultState = GetTopNResults(tensorData, vecResults, topNCount, labels);
+	resultState = GetTopNResults(tensorData.data(), totalOutputSize, vecResults, topNCount);
 
 	if (!resultState) {
 		LOG_ERR("Failed to get top N results set");
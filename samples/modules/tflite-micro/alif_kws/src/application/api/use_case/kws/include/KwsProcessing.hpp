@@ -21,6 +21,7 @@
 #include "BaseProcessing.hpp"
 #include "KwsClassifier.hpp"
 #include "MicroNetKwsMfcc.hpp"
+#include "ethosu/AudioRingBuffer.h"
 
 #include <functional>
 
@@ -57,6 +58,15 @@ namespace app {
          **/
         bool DoPreProcess(const void* input, size_t inferenceIndex = 0) override;
 
+        /**
+         * @brief       Same as above, reading the audio in place from a ring buffer window so
+         *              that sliding the window does not move the audio data.
+         * @param[in]   window           View of at least m_audioDataWindowSize samples.
+         * @param[in]   inferenceIndex   Index of the inference, 0 for the first one.
+         * @return      true if successful, false otherwise.
+         **/
+        bool DoPreProcess(const AudioRingWindow<int16_t>& window, size_t inferenceIndex = 0);
+
         size_t m_audioDataWindowSize;   /* Amount of audio needed for 1 inference. */
         size_t m_audioDataStride;       /* Amount of audio to stride across if doing >1 inference in longer clips. */
 
@@ -68,6 +78,7 @@ namespace app {
 
         audio::MicroNetKwsMFCC m_mfcc;
         audio::SlidingWindow<const int16_t> m_mfccSlidingWindow;
+        std::vector<int16_t> m_mfccFrameAudioData;  /* Audio of one MFCC frame. */
         size_t m_numMfccVectorsInAudioStride;
         size_t m_numReusedMfccVectors;
         std::function<void (std::vector<int16_t>&, int, bool, size_t)> m_mfccFeatureCalculator;
@@ -97,6 +108,71 @@ namespace app {
                     std::function<std::vector<T> (std::vector<int16_t>& )> compute);
     };
 
+    /**
+     * @brief   Streaming pre-processing for Keyword Spotting.
+     *          Keeps the MFCC feature vectors of the current window in a ring and, for each
+     *          new hop of audio, computes only the feature vectors of the new frames. The ring
+     *          is written to the input tensor in time order, the model sees the same features
+     *          as with KwsPreProcess.
+     *
+     *          The first call, and the first call after Reset(), computes the whole window.
+     *
+     *          With CONFIG_KWS_MFCC_FIXED_POINT the features are computed by the fixed-point
+     *          MFCC, for int8 input tensors only.
+     */
+    class KwsStreamingPreProcess {
+
+    public:
+        /**
+         * @brief       Constructor, same parameters as KwsPreProcess.
+         **/
+        explicit KwsStreamingPreProcess(TfLiteTensor* inputTensor, size_t numFeatures,
+                                        size_t numFeatureFrames, int mfccFrameLength,
+                                        int mfccFrameStride);
+
+        /**
+         * @brief       Compute the features of the audio added since the previous call and
+         *              load the features of the whole window into the input tensor.
+         * @param[in]   window       View of the latest audio, at least m_audioDataWindowSize
+         *                           samples, the new samples at its end.
+         * @param[in]   newSamples   Samples added since the previous call, a multiple of
+         *                           the MFCC frame stride.
+         * @return      true if successful, false otherwise.
+         **/
+        bool DoPreProcess(const AudioRingWindow<int16_t>& window, size_t newSamples);
+
+        /** @brief Drop the features, the next call computes the whole window. */
+        void Reset();
+
+        size_t m_audioDataWindowSize;   /* Amount of audio needed for 1 inference. */
+
+    private:
+        TfLiteTensor* m_inputTensor;    /* Model input tensor. */
+        const size_t m_mfccFrameLength;
+        const size_t m_mfccFrameStride;
+        const size_t m_numMfccFrames;
+
+#if defined(CONFIG_KWS_MFCC_FIXED_POINT)
+        audio::MicroNetKwsMfccQ15 m_mfcc;
+#else
+        audio::MicroNetKwsMFCC m_mfcc;
+#endif
+        std::vector<int16_t> m_mfccFrameAudioData;  /* Audio of one MFCC frame. */
+        std::vector<uint8_t> m_features;            /* Ring of m_numMfccFrames feature vectors. */
+        size_t m_featureSize;                       /* One feature vector, in bytes. */
+        size_t m_oldestFeature = 0;                 /* Ring position of the oldest frame. */
+        bool m_primed = false;
+        bool m_quantised = false;
+        float m_quantScale = 0.f;
+        int m_quantOffset = 0;
+
+        /**
+         * @brief       Compute the features of the frame starting at offset in the window
+         *              over the oldest feature vector of the ring.
+         **/
+        void ComputeFrame(const AudioRingWindow<int16_t>& window, size_t offset);
+    };
+
     /**
      * @brief   Post-processing class for Keyword Spotting use case.
      *          Implements methods declared by BasePostProcess and anything else needed
@@ -109,7 +185,8 @@ namespace app {
         KwsClassifier& m_kwsClassifier;                    /* KWS Classifier object. */
         const std::vector<std::string>& m_labels;          /* KWS Labels. */
         std::vector<ClassificationResult>& m_results;      /* Results vector for a single inference. */
-        std::vector<std::vector<float>> m_resultHistory;   /* Store previous results so they can be averaged. */
+        KwsClassifier::ResultHistory m_resultHistory;      /* Store previous results so they can be averaged. */
+        bool m_historyValid = true;                        /* Averaging window within its capacity. */
     public:
         /**
          * @brief           Constructor
@@ -117,6 +194,8 @@ namespace app {
          * @param[in]       classifier     Classifier object used to get top N results from classification.
          * @param[in]       labels         Vector of string labels to identify each output of the model.
          * @param[in/out]   results        Vector of classification results to store decoded outputs.
+         * @param[in]       averagingWindowLen  Number of results averaged, up to
+         *                                      KwsClassifier::ms_maxAveragingWindowLen.
          **/
         KwsPostProcess(TfLiteTensor* outputTensor, KwsClassifier& classifier,
                        const std::vector<std::string>& labels,
@@ -19,6 +19,7 @@
 
 #include "ClassificationResult.hpp"
 
+#include <cstddef>
 #include <vector>
 
 namespace arm {
@@ -31,13 +32,17 @@ namespace kws {
     class KwsResult {
 
     public:
-        ResultVec       m_resultVec;        /* Container for "thresholded" classification results. */
-        float           m_timeStamp;        /* Audio timestamp for this result. */
-        uint32_t        m_inferenceNumber;  /* Corresponding inference number. */
-        float           m_threshold;        /* Threshold value for `m_resultVec`. */
+        /* Capacity for "thresholded" results, further ones are the least likely. */
+        static constexpr size_t ms_maxResults = 4;
 
-        KwsResult() = delete;
-        KwsResult(ResultVec&        resultVec,
+        ClassificationResult m_results[ms_maxResults];  /* "Thresholded" classification results, highest first. */
+        size_t          m_numResults = 0;   /* Number of results in `m_results`. */
+        float           m_timeStamp = 0.f;  /* Audio timestamp for this result. */
+        uint32_t        m_inferenceNumber = 0;  /* Corresponding inference number. */
+        float           m_threshold = 0.f;  /* Threshold value for `m_results`. */
+
+        KwsResult() = default;
+        KwsResult(const ResultVec&  resultVec,
                   const float       timestamp,
                   const uint32_t    inferenceIdx,
                   const float       scoreThreshold) {
@@ -46,16 +51,49 @@ namespace kws {
             this->m_timeStamp = timestamp;
             this->m_inferenceNumber = inferenceIdx;
 
-            this->m_resultVec = ResultVec();
             for (auto& i : resultVec) {
-                if (i.m_normalisedVal >= (double)this->m_threshold) {
-                    this->m_resultVec.emplace_back(i);
+                if (i.m_normalisedVal >= (double)this->m_threshold &&
+                    this->m_numResults < ms_maxResults) {
+                    this->m_results[this->m_numResults++] = i;
                 }
             }
         }
         ~KwsResult() = default;
     };
 
+    /**
+     * @brief   Fixed capacity memory of the latest KWS results, the oldest result
+     *          is overwritten once full.
+     */
+    template <size_t Capacity>
+    class KwsResultMemory {
+
+    public:
+        void Push(const KwsResult& result) {
+            this->m_results[(this->m_oldest + this->m_size) % Capacity] = result;
+
+            if (this->m_size < Capacity) {
+                this->m_size++;
+            } else {
+                this->m_oldest = (this->m_oldest + 1) % Capacity;
+            }
+        }
+
+        size_t Size() const {
+            return this->m_size;
+        }
+
+        /* Results by age, 0 is the oldest. */
+        const KwsResult& operator[](size_t i) const {
+            return this->m_results[(this->m_oldest + i) % Capacity];
+        }
+
+    private:
+        KwsResult   m_results[Capacity];
+        size_t      m_oldest = 0;
+        size_t      m_size = 0;
+    };
+
 } /* namespace kws */
 } /* namespace app */
 } /* namespace arm */
@@ -18,12 +18,9 @@
 
 #include "TensorFlowLiteMicro.hpp"
 #include "PlatformMath.hpp"
-#include "KwsClassifier.hpp"
 
 #include <vector>
-#include <algorithm>
 #include <string>
-#include <set>
 #include <cstdint>
 #include <cinttypes>
 #include <zephyr/logging/log.h>
@@ -39,7 +36,7 @@ bool KwsClassifier::GetClassificationResults(TfLiteTensor *outputTensor,
 					     std::vector<ClassificationResult> &vecResults,
 					     const std::vector<std::string> &labels,
 					     uint32_t topNCount, bool useSoftmax,
-					     std::vector<std::vector<float>> &resultHistory)
+					     ResultHistory &resultHistory)
 {
 	if (outputTensor == nullptr) {
 		LOG_ERR("Output vector is null pointer.");
@@ -64,16 +61,26 @@ bool KwsClassifier::GetClassificationResults(TfLiteTensor *outputTensor,
 	}
 
 	bool resultState;
-	vecResults.clear();
+	const bool averaging = resultHistory.GetWindowLength() > 1;
+
+	/* Without averaging the int8 output is ranked directly. */
+	if (outputTensor->type == kTfLiteInt8 && !averaging) {
+		return GetInt8TopNResults(outputTensor, vecResults, labels, topNCount, useSoftmax);
+	}
+
+	if (totalOutputSize > ms_maxClasses) {
+		LOG_ERR("Output size exceeds %zu classes", ms_maxClasses);
+		return false;
+	} else if (averaging && resultHistory.GetNumClasses() != totalOutputSize) {
+		LOG_ERR("Averaging window doesn't match the output size");
+		return false;
+	}
 
 	/* De-Quantize Output Tensor */
 	QuantParams quantParams = GetTensorQuantParams(outputTensor);
 
-	/* Floating point tensor data to be populated
-	 * NOTE: The assumption here is that the output tensor size isn't too
-	 * big and therefore, there's neglibible impact on heap usage. */
-	std::vector<float> resultData(totalOutputSize);
-	resultData.resize(totalOutputSize);
+	/* Floating point tensor data to be populated */
+	float resultData[ms_maxClasses];
 
 	/* Populate the floating point buffer */
 	switch (outputTensor->type) {
@@ -87,9 +94,17 @@ bool KwsClassifier::GetClassificationResults(TfLiteTensor *outputTensor,
 	}
 	case kTfLiteInt8: {
 		int8_t *tensor_buffer = tflite::GetTensorData<int8_t>(outputTensor);
+		m_int8Classifier.Init(quantParams.scale, quantParams.offset);
+
+		/* Lookup table softmax, no expf() per class. */
+		if (useSoftmax) {
+			m_int8Classifier.Softmax(tensor_buffer, totalOutputSize, resultData);
+			useSoftmax = false;
+			break;
+		}
+
 		for (size_t i = 0; i < totalOutputSize; ++i) {
-			resultData[i] = quantParams.scale *
-					(static_cast<float>(tensor_buffer[i]) - quantParams.offset);
+			resultData[i] = m_int8Classifier.Dequantize(tensor_buffer[i]);
 		}
 		break;
 	}
@@ -107,18 +122,16 @@ bool KwsClassifier::GetClassificationResults(TfLiteTensor *outputTensor,
 	}
 
 	if (useSoftmax) {
-		math::MathUtils::SoftmaxF32(resultData);
+		math::MathUtils::SoftmaxF32(resultData, totalOutputSize);
 	}
 
 	/* If keeping track of recent results, update and take an average. */
-	if (resultHistory.size() > 1) {
-		std::rotate(resultHistory.begin(), resultHistory.begin() + 1, resultHistory.end());
-		resultHistory.back() = resultData;
-		AveragResults(resultHistory, resultData);
+	if (averaging) {
+		resultHistory.Push(resultData, resultData);
 	}
 
 	/* Get the top N results. */
-	resultState = GetTopNResults(resultData, vecResults, topNCount, labels);
+	resultState = GetTopNResults(resultData, totalOutputSize, vecResults, topNCount);
 
 	if (!resultState) {
 		LOG_ERR("Failed to get top N results set");
@@ -128,19 +141,5 @@ bool KwsClassifier::GetClassificationResults(TfLiteTensor *outputTensor,
 	return true;
 }
 
-void app::KwsClassifier::AveragResults(const std::vector<std::vector<float>> &resultHistory,
-				       std::vector<float> &averageResult)
-{
-	/* Compute averages of each class across the window length. */
-	float sum;
-	for (size_t j = 0; j < averageResult.size(); j++) {
-		sum = 0;
-		for (size_t i = 0; i < resultHistory.size(); i++) {
-			sum += resultHistory[i][j];
-		}
-		averageResult[j] = (sum / resultHistory.size());
-	}
-}
-
 } /* namespace app */
 } /* namespace arm */
\ No newline at end of file
@@ -41,6 +41,7 @@ KwsPreProcess::KwsPreProcess(TfLiteTensor *inputTensor, size_t numFeatures, size
 	this->m_mfccSlidingWindow = audio::SlidingWindow<const int16_t>(
 		nullptr, this->m_audioDataWindowSize, this->m_mfccFrameLength,
 		this->m_mfccFrameStride);
+	this->m_mfccFrameAudioData.resize(this->m_mfccFrameLength);
 
 	/* For longer audio clips we choose to move by half the audio window size
 	 * => for a 1 second window size there is an overlap of 0.5 seconds. */
@@ -99,6 +100,32 @@ bool KwsPreProcess::DoPreProcess(const void *data, size_t inferenceIndex)
 	return true;
 }
 
+bool KwsPreProcess::DoPreProcess(const AudioRingWindow<int16_t> &window, size_t inferenceIndex)
+{
+	if (window.Size() < this->m_audioDataWindowSize) {
+		LOG_ERR("Audio window too short: %zu < %zu", window.Size(),
+			this->m_audioDataWindowSize);
+		return false;
+	}
+
+	bool useCache = inferenceIndex > 0 && this->m_numReusedMfccVectors > 0;
+
+	for (size_t i = 0; i < this->m_numMfccFrames; i++) {
+		/* Frames served from the feature cache do not read their audio. */
+		if (!useCache || i >= this->m_numReusedMfccVectors) {
+			window.CopyTo(i * this->m_mfccFrameStride, this->m_mfccFrameLength,
+				      this->m_mfccFrameAudioData.data());
+		}
+
+		this->m_mfccFeatureCalculator(this->m_mfccFrameAudioData, i, useCache,
+					      this->m_numMfccVectorsInAudioStride);
+	}
+
+	LOG_DBG("Input tensor populated");
+
+	return true;
+}
+
 /**
  * @brief Generic feature calculator factory.
  *
@@ -190,6 +217,132 @@ KwsPreProcess::GetFeatureCalculator(audio::MicroNetKwsMFCC &mfcc, TfLiteTensor *
 	return mfccFeatureCalc;
 }
 
+KwsStreamingPreProcess::KwsStreamingPreProcess(TfLiteTensor *inputTensor, size_t numFeatures,
+					       size_t numMfccFrames, int mfccFrameLength,
+					       int mfccFrameStride)
+	: m_inputTensor{inputTensor}, m_mfccFrameLength{static_cast<size_t>(mfccFrameLength)},
+	  m_mfccFrameStride{static_cast<size_t>(mfccFrameStride)}, m_numMfccFrames{numMfccFrames},
+	  m_mfcc(numFeatures, mfccFrameLength)
+{
+#if defined(CONFIG_KWS_MFCC_FIXED_POINT)
+	if (!this->m_mfcc.Init()) {
+		LOG_ERR("Fixed-point MFCC not initialised.");
+	}
+#else
+	this->m_mfcc.Init();
+#endif
+
+	this->m_audioDataWindowSize = this->m_numMfccFrames * this->m_mfccFrameStride +
+				      (this->m_mfccFrameLength - this->m_mfccFrameStride);
+
+	TfLiteQuantization quant = inputTensor->quantization;
+
+	if (kTfLiteAffineQuantization == quant.type) {
+		auto *quantParams = (TfLiteAffineQuantization *)quant.params;
+
+		if (inputTensor->type != kTfLiteInt8) {
+			LOG_ERR("Tensor type %s not supported",
+				TfLiteTypeGetName(inputTensor->type));
+		}
+
+		this->m_quantised = true;
+		this->m_quantScale = quantParams->scale->data[0];
+		this->m_quantOffset = quantParams->zero_point->data[0];
+		this->m_featureSize = numFeatures * sizeof(int8_t);
+	} else {
+		this->m_featureSize = numFeatures * sizeof(float);
+	}
+
+#if defined(CONFIG_KWS_MFCC_FIXED_POINT)
+	if (!this->m_quantised) {
+		LOG_ERR("Fixed-point MFCC needs an int8 input tensor.");
+	}
+
+	this->m_mfcc.SetQuantisation(this->m_quantScale, this->m_quantOffset);
+#endif
+
+	this->m_mfccFrameAudioData.resize(this->m_mfccFrameLength);
+	this->m_features.resize(this->m_numMfccFrames * this->m_featureSize);
+}
+
+void KwsStreamingPreProcess::Reset()
+{
+	this->m_primed = false;
+}
+
+void KwsStreamingPreProcess::ComputeFrame(const AudioRingWindow<int16_t> &window, size_t offset)
+{
+	uint8_t *dst = this->m_features.data() + this->m_oldestFeature * this->m_featureSize;
+
+#if defined(CONFIG_KWS_MFCC_FIXED_POINT)
+	const int16_t *frame = window.Data(offset);
+
+	if (!window.IsContiguous(offset, this->m_mfccFrameLength)) {
+		window.CopyTo(offset, this->m_mfccFrameLength, this->m_mfccFrameAudioData.data());
+		frame = this->m_mfccFrameAudioData.data();
+	}
+
+	this->m_mfcc.MfccComputeQuant(frame, reinterpret_cast<int8_t *>(dst));
+#else
+	window.CopyTo(offset, this->m_mfccFrameLength, this->m_mfccFrameAudioData.data());
+
+	if (this->m_quantised) {
+		auto features = this->m_mfcc.MfccComputeQuant<int8_t>(
+			this->m_mfccFrameAudioData, this->m_quantScale, this->m_quantOffset);
+		std::memcpy(dst, features.data(), this->m_featureSize);
+	} else {
+		auto features = this->m_mfcc.MfccCompute(this->m_mfccFrameAudioData);
+		std::memcpy(dst, features.data(), this->m_featureSize);
+	}
+#endif
+
+	/* The new frame is the latest one, the next oldest moves up. */
+	if (++this->m_oldestFeature == this->m_numMfccFrames) {
+		this->m_oldestFeature = 0;
+	}
+}
+
+bool KwsStreamingPreProcess::DoPreProcess(const AudioRingWindow<int16_t> &window,
+					  size_t newSamples)
+{
+	if (window.Size() < this->m_audioDataWindowSize) {
+		LOG_ERR("Audio window too short: %zu < %zu", window.Size(),
+			this->m_audioDataWindowSize);
+		return false;
+	} else if (newSamples % this->m_mfccFrameStride != 0) {
+		LOG_ERR("New audio (%zu) is not a multiple of the frame stride (%zu)", newSamples,
+			this->m_mfccFrameStride);
+		return false;
+	}
+
+	size_t newFrames = newSamples / this->m_mfccFrameStride;
+
+	if (!this->m_primed || newFrames > this->m_numMfccFrames) {
+		newFrames = this->m_numMfccFrames;
+		this->m_oldestFeature = 0;
+		this->m_primed = true;
+	}
+
+	/* The last frame ends with the window, frames are m_mfccFrameStride apart. */
+	const size_t windowStart = window.Size() - this->m_audioDataWindowSize;
+
+	for (size_t i = this->m_numMfccFrames - newFrames; i < this->m_numMfccFrames; i++) {
+		this->ComputeFrame(window, windowStart + i * this->m_mfccFrameStride);
+	}
+
+	/* Unroll the ring into the tensor, oldest frame first. */
+	auto *tensorData = tflite::GetTensorData<uint8_t>(this->m_inputTensor);
+	const size_t headBytes = this->m_oldestFeature * this->m_featureSize;
+	const size_t tailBytes = this->m_features.size() - headBytes;
+
+	std::memcpy(tensorData, this->m_features.data() + headBytes, tailBytes);
+	std::memcpy(tensorData + tailBytes, this->m_features.data(), headBytes);
+
+	LOG_DBG("Input tensor populated, %zu new frames", newFrames);
+
+	return true;
+}
+
 KwsPostProcess::KwsPostProcess(TfLiteTensor *outputTensor, KwsClassifier &classifier,
 			       const std::vector<std::string> &labels,
 			       std::vector<ClassificationResult> &results,
@@ -197,11 +350,21 @@ KwsPostProcess::KwsPostProcess(TfLiteTensor *outputTensor, KwsClassifier &classi
 	: m_outputTensor{outputTensor}, m_kwsClassifier{classifier}, m_labels{labels},
 	  m_results{results}
 {
-	this->m_resultHistory = {averagingWindowLen, std::vector<float>(labels.size())};
+	/* Fixed capacity history, a window of 1 or less does no averaging. */
+	if (averagingWindowLen > 1 &&
+	    !this->m_resultHistory.Init(labels.size(), averagingWindowLen)) {
+		LOG_ERR("Averaging window of %zu results over %zu classes is too large",
+			averagingWindowLen, labels.size());
+		this->m_historyValid = false;
+	}
 }
 
 bool KwsPostProcess::DoPostProcess()
 {
+	if (!this->m_historyValid) {
+		return false;
+	}
+
 	return this->m_kwsClassifier.GetClassificationResults(this->m_outputTensor, this->m_results,
 							      this->m_labels, 1, true,
 							      this->m_resultHistory);
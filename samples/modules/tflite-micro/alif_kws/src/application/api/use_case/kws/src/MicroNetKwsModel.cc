@@ -35,11 +35,13 @@ bool arm::app::MicroNetKwsModel::EnlistOperations()
 	this->m_opResolver.AddRelu();
 #endif
 
+#if defined(CONFIG_ARM_ETHOS_U)
 	if (kTfLiteOk == this->m_opResolver.AddEthosU()) {
 		LOG_INF("Added %s support to op resolver", tflite::GetString_ETHOSU());
 	} else {
 		LOG_ERR("Failed to add Arm NPU support to op resolver.");
 		return false;
 	}
+#endif
 	return true;
 }
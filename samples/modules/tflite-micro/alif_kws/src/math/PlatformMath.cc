@@ -120,9 +120,99 @@ void MathUtils::FftInitF32(const uint16_t fftLen, FftInstance &fftInstance, cons
 	LOG_DBG("Optimised FFT will be used: %s.",
 	      fftInstance.m_optimisedOptionAvailable ? "yes" : "no");
 
+	fftInstance.m_twiddles.clear();
+	if (!fftInstance.m_optimisedOptionAvailable && fftLen >= 2 && (fftLen & (fftLen - 1)) == 0) {
+		fftInstance.m_twiddles.resize(fftLen);
+		for (uint32_t k = 0; k < fftLen / 2u; k++) {
+			const auto angle = static_cast<float>(2 * M_PI * k / fftLen);
+			fftInstance.m_twiddles[2 * k] = MathUtils::CosineF32(angle);
+			fftInstance.m_twiddles[2 * k + 1] = -MathUtils::SineF32(angle);
+		}
+	}
+
 	fftInstance.m_initialised = true;
 }
 
+/* In place radix-2 complex FFT of interleaved values, W^k is at twiddles[2 * k * stride]. */
+static void FftRadix2F32(float *data, const uint32_t fftLen, const float *twiddles,
+			 const uint32_t stride)
+{
+	/* Bit reversal permutation. */
+	for (uint32_t i = 0, j = 0; i < fftLen; i++) {
+		if (i < j) {
+			std::swap(data[2 * i], data[2 * j]);
+			std::swap(data[2 * i + 1], data[2 * j + 1]);
+		}
+
+		uint32_t bit = fftLen >> 1;
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+		j |= bit;
+	}
+
+	for (uint32_t len = 2, step = stride * fftLen / 2; len <= fftLen; len <<= 1, step >>= 1) {
+		const uint32_t half = len / 2;
+
+		for (uint32_t k = 0; k < half; k++) {
+			const float wr = twiddles[2 * k * step];
+			const float wi = twiddles[2 * k * step + 1];
+
+			for (uint32_t a = k; a < fftLen; a += len) {
+				float *x = data + 2 * a;
+				float *y = data + 2 * (a + half);
+				const float tr = y[0] * wr - y[1] * wi;
+				const float ti = y[0] * wi + y[1] * wr;
+
+				y[0] = x[0] - tr;
+				y[1] = x[1] - ti;
+				x[0] += tr;
+				x[1] += ti;
+			}
+		}
+	}
+}
+
+/* Real FFT as a half length complex FFT of the even and odd samples, then split. */
+static void FftRealRadix2F32(const float *input, float *fftOutput, const uint32_t fftLen,
+			     const float *twiddles)
+{
+	const uint32_t half = fftLen / 2;
+
+	/* z[m] = x[2m] + i * x[2m + 1] is the input itself read as interleaved values. */
+	if (input != fftOutput) {
+		std::copy(input, input + fftLen, fftOutput);
+	}
+	FftRadix2F32(fftOutput, half, twiddles, 2);
+
+	/* Bins 0 and N/2 are real, packed as [real0, realN/2]. */
+	const float z0Real = fftOutput[0];
+	const float z0Imag = fftOutput[1];
+	fftOutput[0] = z0Real + z0Imag;
+	fftOutput[1] = z0Real - z0Imag;
+
+	/* X[k] = E + W^k * O and X[M - k] = conj(E - W^k * O), with
+	 * E = (Z[k] + conj(Z[M - k])) / 2 and O = (Z[k] - conj(Z[M - k])) / 2i. */
+	for (uint32_t k = 1; k <= half / 2; k++) {
+		float *a = fftOutput + 2 * k;
+		float *b = fftOutput + 2 * (half - k);
+		const float evenReal = 0.5f * (a[0] + b[0]);
+		const float evenImag = 0.5f * (a[1] - b[1]);
+		const float oddReal = 0.5f * (a[1] + b[1]);
+		const float oddImag = -0.5f * (a[0] - b[0]);
+		const float wr = twiddles[2 * k];
+		const float wi = twiddles[2 * k + 1];
+		const float tr = oddReal * wr - oddImag * wi;
+		const float ti = oddReal * wi + oddImag * wr;
+
+		a[0] = evenReal + tr;
+		a[1] = evenImag + ti;
+		b[0] = evenReal - tr;
+		b[1] = ti - evenImag;
+	}
+}
+
+/* DFT, for lengths that are not a power of 2. */
 static void FftRealF32(std::vector<float> &input, std::vector<float> &fftOutput)
 {
 	const size_t inputLength = input.size();
@@ -198,6 +288,11 @@ void MathUtils::FftF32(std::vector<float> &input, std::vector<float> &fftOutput,
 			return;
 		}
 #endif /* __ARM_FEATURE_DSP */
+		if (!fftInstance.m_twiddles.empty()) {
+			FftRealRadix2F32(input.data(), fftOutput.data(), fftInstance.m_fftLen,
+					 fftInstance.m_twiddles.data());
+			return;
+		}
 		FftRealF32(input, fftOutput);
 		return;
 
@@ -213,6 +308,15 @@ void MathUtils::FftF32(std::vector<float> &input, std::vector<float> &fftOutput,
 			return;
 		}
 #endif /* __ARM_FEATURE_DSP */
+		if (!fftInstance.m_twiddles.empty()) {
+			if (&input != &fftOutput) {
+				std::copy(input.begin(), input.begin() + fftInstance.m_fftLen * 2,
+					  fftOutput.begin());
+			}
+			FftRadix2F32(fftOutput.data(), fftInstance.m_fftLen,
+				     fftInstance.m_twiddles.data(), 1);
+			return;
+		}
 		FftComplexF32(input, fftOutput);
 		return;
 
@@ -222,6 +326,128 @@ void MathUtils::FftF32(std::vector<float> &input, std::vector<float> &fftOutput,
 	}
 }
 
+bool MathUtils::FftInitQ15(const uint16_t fftLen, FftInstanceQ15 &fftInstance)
+{
+	fftInstance.m_fftLen = fftLen;
+	fftInstance.m_initialised = false;
+	fftInstance.m_optimisedOptionAvailable = false;
+
+	if (fftLen < 2 || (fftLen & (fftLen - 1)) != 0) {
+		LOG_ERR("FFT len %d is not a power of 2", fftLen);
+		return false;
+	}
+
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+	if (ARM_MATH_SUCCESS != arm_rfft_init_q15(&fftInstance.m_instance, fftLen, 0, 1)) {
+		LOG_ERR("Failed to initialise Q15 FFT for len %d", fftLen);
+		return false;
+	}
+
+	fftInstance.m_optimisedOptionAvailable = true;
+#endif /* __ARM_FEATURE_DSP */
+
+	LOG_DBG("Optimised Q15 FFT will be used: %s.",
+		fftInstance.m_optimisedOptionAvailable ? "yes" : "no");
+
+	fftInstance.m_twiddles.clear();
+	if (!fftInstance.m_optimisedOptionAvailable) {
+		fftInstance.m_twiddles.resize(fftLen);
+		for (uint32_t k = 0; k < fftLen / 2u; k++) {
+			const auto angle = static_cast<float>(2 * M_PI * k / fftLen);
+			fftInstance.m_twiddles[2 * k] =
+				static_cast<int16_t>(lroundf(MathUtils::CosineF32(angle) * 32767));
+			fftInstance.m_twiddles[2 * k + 1] =
+				static_cast<int16_t>(lroundf(-MathUtils::SineF32(angle) * 32767));
+		}
+	}
+
+	fftInstance.m_initialised = true;
+	return true;
+}
+
+/* Radix-2 complex FFT of the real input, halving every stage as arm_rfft_q15 does.
+ * W^k of the full length is at twiddles[2 * k]. */
+static void FftRealQ15(const int16_t *input, int16_t *fftOutput, const uint32_t fftLen,
+		       const int16_t *twiddles)
+{
+	/* Bit reversed copy, imaginary parts zero. */
+	for (uint32_t i = 0, j = 0; i < fftLen; i++) {
+		fftOutput[2 * j] = input[i];
+		fftOutput[2 * j + 1] = 0;
+
+		uint32_t bit = fftLen >> 1;
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+		j |= bit;
+	}
+
+	for (uint32_t len = 2; len <= fftLen; len <<= 1) {
+		const uint32_t half = len / 2;
+		const uint32_t stride = fftLen / len;
+
+		for (uint32_t k = 0; k < half; k++) {
+			const int32_t wr = twiddles[2 * k * stride];
+			const int32_t wi = twiddles[2 * k * stride + 1];
+
+			for (uint32_t a = k; a < fftLen; a += len) {
+				int16_t *x = fftOutput + 2 * a;
+				int16_t *y = fftOutput + 2 * (a + half);
+				const int32_t tr = (y[0] * wr - y[1] * wi) >> 15;
+				const int32_t ti = (y[0] * wi + y[1] * wr) >> 15;
+
+				y[0] = static_cast<int16_t>((x[0] - tr) >> 1);
+				y[1] = static_cast<int16_t>((x[1] - ti) >> 1);
+				x[0] = static_cast<int16_t>((x[0] + tr) >> 1);
+				x[1] = static_cast<int16_t>((x[1] + ti) >> 1);
+			}
+		}
+	}
+}
+
+void MathUtils::FftQ15(int16_t *input, int16_t *fftOutput, FftInstanceQ15 &fftInstance)
+{
+	if (!fftInstance.m_initialised) {
+		LOG_ERR("FFT uninitialised");
+		return;
+	}
+
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+	if (fftInstance.m_optimisedOptionAvailable) {
+		arm_rfft_q15(&fftInstance.m_instance, input, fftOutput);
+		return;
+	}
+#endif /* __ARM_FEATURE_DSP */
+	FftRealQ15(input, fftOutput, fftInstance.m_fftLen, fftInstance.m_twiddles.data());
+}
+
+void MathUtils::ComplexMagnitudeQ15(const int16_t *ptrSrc, int16_t *ptrDst,
+				    const uint32_t numSamples)
+{
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+	arm_cmplx_mag_q15(ptrSrc, ptrDst, numSamples);
+#else  /* __ARM_FEATURE_DSP */
+	for (uint32_t j = 0; j < numSamples; ++j) {
+		const int32_t real = *ptrSrc++;
+		const int32_t im = *ptrSrc++;
+		uint32_t sq = static_cast<uint32_t>(real * real) + static_cast<uint32_t>(im * im);
+
+		/* Integer square root, then Q1.15 to Q2.14. */
+		uint32_t root = 0;
+		for (uint32_t bit = 1u << 30; bit != 0; bit >>= 2) {
+			if (sq >= root + bit) {
+				sq -= root + bit;
+				root = (root >> 1) + bit;
+			} else {
+				root >>= 1;
+			}
+		}
+
+		*ptrDst++ = static_cast<int16_t>(root >> 1);
+	}
+#endif /* __ARM_FEATURE_DSP */
+}
+
 void MathUtils::VecLogarithmF32(std::vector<float> &input, std::vector<float> &output)
 {
 #if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
@@ -270,10 +496,15 @@ bool MathUtils::ComplexMagnitudeSquaredF32(float *ptrSrc, const uint32_t srcLen,
 }
 
 void MathUtils::SoftmaxF32(std::vector<float> &vec)
+{
+	SoftmaxF32(vec.data(), vec.size());
+}
+
+void MathUtils::SoftmaxF32(float *ptrSrc, uint32_t srcLen)
 {
 	/* Fix for numerical stability and apply exp. */
-	auto start = vec.begin();
-	auto end = vec.end();
+	float *start = ptrSrc;
+	float *end = ptrSrc + srcLen;
 
 	float maxValue = *std::max_element(start, end);
 	for (auto it = start; it != end; ++it) {
@@ -16,6 +16,5 @@ int audio_init(int sampling_rate);
 void audio_uninit(void);
 int get_audio_data(int16_t *data, int len);
 int wait_for_audio(void);
-void audio_preprocessing(int16_t *data, int len);
 
 #endif
@@ -0,0 +1,28 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#ifndef HOSTOPTIONS_H
+#define HOSTOPTIONS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Host build (native_sim) input files, CONFIG_KWS_* defaults or command line options */
+const char *kws_host_model_file(void);
+const char *kws_host_clip_list(void);
+
+/* End the simulation with an exit status */
+void kws_host_exit(int status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -39,6 +39,14 @@ namespace app {
      **/
     bool ClassifyAudioHandler(arm::app::ApplicationContext& ctx, bool oneshot);
 
+    /**
+     * @brief       Classifies the labelled WAV clips of the host build (CONFIG_KWS_WAV_INPUT)
+     *              and reports the accuracy, the time of each stage and the real-time factor.
+     * @param[in]   ctx         Pointer to the application context.
+     * @return      true if the accuracy reaches CONFIG_KWS_EVAL_MIN_ACCURACY.
+     **/
+    bool EvaluateClipsHandler(arm::app::ApplicationContext& ctx);
+
 } /* namespace app */
 } /* namespace alif */
 
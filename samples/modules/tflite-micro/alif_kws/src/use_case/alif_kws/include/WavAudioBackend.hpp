@@ -0,0 +1,43 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#ifndef WAVAUDIOBACKEND_H
+#define WAVAUDIOBACKEND_H
+
+#include <stdint.h>
+
+/*
+ * Host build audio input: the AudioBackend functions read the WAV clips of the clip list
+ * (kws_host_clip_list()) instead of a microphone, one after the other, until -ENODATA.
+ *
+ * Each line of the list is "<path> [label]", the path being relative to the directory of
+ * the list. Without a label, the first directory of the path is the label, which is the
+ * layout of the Speech Commands dataset and its testing_list.txt.
+ *
+ * Clips must be 16-bit PCM, mono or stereo (averaged), at the sampling rate given to
+ * audio_init().
+ */
+
+struct wav_clip {
+	char path[256];
+	char label[32];
+	/* Samples in the clip */
+	uint32_t samples;
+};
+
+/*
+ * Move to the next clip of the list. From then on, reads past the end of the clip return
+ * silence until the next call, instead of continuing with the next clip.
+ *
+ * Returns 0, -ENODATA at the end of the list, or a negative error for a clip that cannot be
+ * read (clip->path is then set, the next call moves on).
+ */
+int wav_next_clip(struct wav_clip *clip);
+
+#endif
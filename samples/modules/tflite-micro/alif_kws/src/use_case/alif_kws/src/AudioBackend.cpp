@@ -8,6 +8,7 @@
  */
 
 #include "AudioBackend.hpp"
+#include "ethosu/AudioDownmix.h"
 
 #include <zephyr/logging/log.h>
 #include <zephyr/devicetree.h>
@@ -22,6 +23,8 @@ LOG_MODULE_REGISTER(AudioBackend, LOG_LEVEL_DBG);
 BUILD_ASSERT(CONFIG_AUDIO_STRIDE % CONFIG_SAMPLE_CNT == 0,
 	     "CONFIG_AUDIO_STRIDE must be a multiple of CONFIG_SAMPLE_CNT");
 BUILD_ASSERT(CONFIG_SAMPLE_CNT % 4 == 0, "CONFIG_SAMPLE_CNT must be a multiple of 4");
+BUILD_ASSERT(CONFIG_AUDIO_CHANNELS == 1 || CONFIG_AUDIO_CHANNELS == 2,
+	     "CONFIG_AUDIO_CHANNELS must be 1 or 2");
 
 #define I2S_MICS DT_NODE_EXISTS(DT_ALIAS(i2s_mic))
 
@@ -39,10 +42,20 @@ BUILD_ASSERT(CONFIG_SAMPLE_CNT % 4 == 0, "CONFIG_SAMPLE_CNT must be a multiple o
 #define BUFFER_SIZE       (AUDIO_CHANNELS * SAMPLE_CNT * SAMPLE_SIZE)
 #define THREAD_STACK_SIZE CONFIG_THREAD_STACK_SIZE
 #define THREAD_PRIORITY   CONFIG_THREAD_PRIORITY
-#define I2S_GAIN          CONFIG_I2S_GAIN
 #define CHANNEL_4         4
 #define CHANNEL_5         5
-#define PDM_CHANNELS      PDM_MASK_CHANNEL_4 | PDM_MASK_CHANNEL_5
+
+#if I2S_MICS
+#define CAPTURE_GAIN CONFIG_I2S_GAIN
+#else
+#define CAPTURE_GAIN 1
+#endif
+
+#if AUDIO_CHANNELS == 1
+#define PDM_CHANNELS PDM_MASK_CHANNEL_4
+#else
+#define PDM_CHANNELS PDM_MASK_CHANNEL_4 | PDM_MASK_CHANNEL_5
+#endif
 
 /* PDM Channel configurations */
 #define PDM_PHASE           0x0000001F
@@ -72,25 +85,6 @@ static struct k_sem rx_ready;
 static int16_t *user_ptr;
 static int user_len;
 
-static int mix_mono_output(int16_t *in, size_t in_size, int16_t *out, size_t out_size)
-{
-	size_t num_samples = in_size / 2;
-
-	if (out_size < num_samples) {
-		LOG_ERR("mix_mono_output param failure %d - %d", out_size, num_samples);
-		return -EINVAL;
-	}
-
-	for (size_t i = 0; i < num_samples; ++i) {
-		int16_t left_channel = in[2 * i];
-		int16_t right_channel = in[2 * i + 1];
-
-		out[i] = (int16_t)((left_channel + right_channel) / 2);
-	}
-
-	return 0;
-}
-
 static int trigger_audio(bool start)
 {
 #if I2S_MICS
@@ -117,15 +111,23 @@ static int audio_handle_rx(void)
 			return rc;
 		}
 
-		int stero_samples = size / SAMPLE_SIZE;
-		rc = mix_mono_output(static_cast<int16_t *>(buffer), stero_samples,
-				     user_ptr + offset, user_len - offset);
-		if (rc < 0) {
-			LOG_ERR("mix_mono_output failed: %i", rc);
-			return rc;
+		const int frames = size / (AUDIO_CHANNELS * SAMPLE_SIZE);
+		if (frames > user_len - offset) {
+			k_mem_slab_free(&mem_slab, buffer);
+			LOG_ERR("mic block of %d frames overflows the audio buffer", frames);
+			return -EINVAL;
 		}
 
-		offset += stero_samples / 2;
+		/* Single pass from the DMA block to its place in the audio ring */
+#if AUDIO_CHANNELS == 2
+		AudioDownmixStereo(static_cast<const int16_t *>(buffer), user_ptr + offset, frames,
+				   CAPTURE_GAIN);
+#else
+		AudioApplyGain(static_cast<const int16_t *>(buffer), user_ptr + offset, frames,
+			       CAPTURE_GAIN);
+#endif
+
+		offset += frames;
 		k_mem_slab_free(&mem_slab, buffer);
 	}
 	return 0;
@@ -305,12 +307,3 @@ int wait_for_audio(void)
 
 	return 0;
 }
-
-void audio_preprocessing(int16_t *data, int len)
-{
-#if I2S_MICS
-	for (int i = 0; i < len; ++i) {
-		data[i] = data[i] * I2S_GAIN;
-	}
-#endif
-}
@@ -0,0 +1,268 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "UseCaseHandler.hpp"
+#include "AudioBackend.hpp"
+#include "KwsClassifier.hpp"
+#include "KwsProcessing.hpp"
+#include "MicroNetKwsModel.hpp"
+#include "WavAudioBackend.hpp"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(EvaluationHandler);
+
+using arm::app::ApplicationContext;
+using arm::app::ClassificationResult;
+using arm::app::KwsClassifier;
+using arm::app::KwsPostProcess;
+using arm::app::KwsStreamingPreProcess;
+using arm::app::MicroNetKwsModel;
+using arm::app::Model;
+
+#define AUDIO_SAMPLES CONFIG_AUDIO_SAMPLES
+#define AUDIO_STRIDE  CONFIG_AUDIO_STRIDE
+
+BUILD_ASSERT(AUDIO_SAMPLES % AUDIO_STRIDE == 0,
+	     "CONFIG_AUDIO_SAMPLES must be a multiple of CONFIG_AUDIO_STRIDE");
+
+/* Captures are synchronous, no stride in flight */
+static int16_t audio_eval[AUDIO_SAMPLES];
+
+namespace alif
+{
+namespace app
+{
+
+namespace
+{
+/* Time of one pipeline stage over all strides */
+struct StageTime {
+	uint64_t totalUs = 0;
+	uint64_t maxUs = 0;
+
+	void Add(uint64_t us)
+	{
+		totalUs += us;
+		maxUs = us > maxUs ? us : maxUs;
+	}
+};
+
+/* Simulated time does not advance while computing, stages are timed on the host clock */
+uint64_t HostTimeUs()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return static_cast<uint64_t>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+}
+
+/* Label index of a clip, words the model does not know are _unknown_ */
+int FindLabel(const std::vector<std::string> &labels, const char *label)
+{
+	for (size_t i = 0; i < labels.size(); i++) {
+		if (labels[i] == label) {
+			return i;
+		}
+	}
+
+	for (size_t i = 0; i < labels.size(); i++) {
+		if (labels[i] == "_unknown_") {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+void PresentStage(const char *name, const StageTime &time, uint32_t strides)
+{
+	LOG_INF("%-15s mean %8.3f ms, max %8.3f ms", name,
+		strides ? (double)time.totalUs / strides / 1000 : 0.0, (double)time.maxUs / 1000);
+}
+} /* namespace */
+
+bool EvaluateClipsHandler(ApplicationContext &ctx)
+{
+	auto &model = ctx.Get<Model &>("model");
+	const auto mfccFrameLength = ctx.Get<int>("frameLength");
+	const auto mfccFrameStride = ctx.Get<int>("frameStride");
+	const auto audioRate = ctx.Get<int>("audioRate");
+	const auto scoreThreshold = ctx.Get<float>("scoreThreshold");
+	const auto &labels = ctx.Get<std::vector<std::string> &>("labels");
+
+	if (!model.IsInited()) {
+		LOG_ERR("Model is not initialised! Terminating processing.");
+		return false;
+	}
+
+	TfLiteTensor *inputTensor = model.GetInputTensor(0);
+	TfLiteTensor *outputTensor = model.GetOutputTensor(0);
+	TfLiteIntArray *inputShape = model.GetInputShape(0);
+	const uint32_t numMfccFeatures = inputShape->data[MicroNetKwsModel::ms_inputColsIdx];
+	const uint32_t numMfccFrames = inputShape->data[MicroNetKwsModel::ms_inputRowsIdx];
+
+	static KwsStreamingPreProcess preProcess = KwsStreamingPreProcess(
+		inputTensor, numMfccFeatures, numMfccFrames, mfccFrameLength, mfccFrameStride);
+	preProcess.Reset();
+
+	std::vector<ClassificationResult> singleInfResult;
+	KwsPostProcess postProcess = KwsPostProcess(
+		outputTensor, ctx.Get<KwsClassifier &>("classifier"), labels, singleInfResult);
+
+	/* Clips per expected label, and those classified right */
+	std::vector<uint32_t> labelClips(labels.size());
+	std::vector<uint32_t> labelCorrect(labels.size());
+	uint32_t clips = 0;
+	uint32_t skipped = 0;
+	uint32_t correct = 0;
+	uint32_t detected = 0;
+	uint32_t strides = 0;
+	StageTime preTime;
+	StageTime infTime;
+	StageTime postTime;
+
+	int err = audio_init(audioRate);
+	if (err) {
+		LOG_ERR("audio_init failed with error: %d", err);
+		return false;
+	}
+
+	memset(audio_eval, 0, sizeof(audio_eval));
+	AudioRingBuffer<int16_t> audioRing(audio_eval, ARRAY_SIZE(audio_eval));
+	struct wav_clip clip;
+
+	while ((err = wav_next_clip(&clip)) != -ENODATA) {
+		const int expected = err ? -1 : FindLabel(labels, clip.label);
+
+		if (expected < 0) {
+			LOG_WRN("Skipping %s", clip.path);
+			skipped++;
+			continue;
+		}
+
+		/* Stream the clip stride by stride, as the live loop does. The last window holds
+		 * the clip, longer clips are cut and shorter ones padded with silence. */
+		for (size_t offset = 0; offset < AUDIO_SAMPLES; offset += AUDIO_STRIDE) {
+			get_audio_data(audioRing.GetWritePointer(), AUDIO_STRIDE);
+			err = wait_for_audio();
+			if (err) {
+				LOG_ERR("%s: read failed with error: %d", clip.path, err);
+				audio_uninit();
+				return false;
+			}
+			audioRing.Commit(AUDIO_STRIDE);
+
+			const AudioRingWindow<int16_t> window = audioRing.GetWindow(AUDIO_SAMPLES);
+			const uint64_t start = HostTimeUs();
+
+			if (!preProcess.DoPreProcess(window, AUDIO_STRIDE)) {
+				LOG_ERR("Pre-processing failed.");
+				audio_uninit();
+				return false;
+			}
+			const uint64_t preEnd = HostTimeUs();
+
+			if (!model.RunInference()) {
+				LOG_ERR("Inference failed.");
+				audio_uninit();
+				return false;
+			}
+			const uint64_t infEnd = HostTimeUs();
+
+			if (!postProcess.DoPostProcess()) {
+				LOG_ERR("Post-processing failed.");
+				audio_uninit();
+				return false;
+			}
+			const uint64_t postEnd = HostTimeUs();
+
+			preTime.Add(preEnd - start);
+			infTime.Add(infEnd - preEnd);
+			postTime.Add(postEnd - infEnd);
+			strides++;
+		}
+
+		const ClassificationResult &top = singleInfResult[0];
+		const bool right = static_cast<int>(top.m_labelIdx) == expected;
+
+		clips++;
+		labelClips[expected]++;
+		if (right) {
+			correct++;
+			labelCorrect[expected]++;
+			detected += top.m_normalisedVal >= scoreThreshold ? 1 : 0;
+		}
+
+		LOG_DBG("%s: %s, classified %s (%f)", clip.path, labels[expected].c_str(),
+			labels[top.m_labelIdx].c_str(), top.m_normalisedVal);
+	}
+
+	audio_uninit();
+
+	const uint64_t processingUs = preTime.totalUs + infTime.totalUs + postTime.totalUs;
+	const uint64_t audioUs = static_cast<uint64_t>(strides) * AUDIO_STRIDE * 1000000 / audioRate;
+	const double realTimeFactor = audioUs ? (double)processingUs / audioUs : 0.0;
+	const double accuracy = clips ? 100.0 * correct / clips : 0.0;
+
+	LOG_INF("Clips: %" PRIu32 " classified, %" PRIu32 " skipped", clips, skipped);
+	LOG_INF("Accuracy: %.2f%% (%" PRIu32 " right), %" PRIu32
+		" right above the %.2f threshold",
+		accuracy, correct, detected, (double)scoreThreshold);
+
+	for (size_t i = 0; i < labels.size(); i++) {
+		if (labelClips[i]) {
+			LOG_INF("  %-10s %6.2f%% of %" PRIu32, labels[i].c_str(),
+				100.0 * labelCorrect[i] / labelClips[i], labelClips[i]);
+		}
+	}
+
+	LOG_INF("Per stride of %d samples, %" PRIu32 " strides:", AUDIO_STRIDE, strides);
+	PresentStage("Preprocessing", preTime, strides);
+	PresentStage("Inference", infTime, strides);
+	PresentStage("Postprocessing", postTime, strides);
+	LOG_INF("Real-time factor: %.4f (%.3f s of processing for %.3f s of audio)",
+		realTimeFactor, (double)processingUs / 1000000, (double)audioUs / 1000000);
+
+	/* One line for scripts comparing runs */
+	printk("csv,clips,skipped,accuracy_pct,detected,pre_mean_us,inf_mean_us,post_mean_us,"
+	       "real_time_factor\n");
+	printk("csv,%" PRIu32 ",%" PRIu32 ",%.2f,%" PRIu32 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+	       ",%.4f\n",
+	       clips, skipped, accuracy, detected, strides ? preTime.totalUs / strides : 0,
+	       strides ? infTime.totalUs / strides : 0, strides ? postTime.totalUs / strides : 0,
+	       realTimeFactor);
+
+	if (clips == 0) {
+		LOG_ERR("No clip classified");
+		return false;
+	}
+
+	/* Matched by the twister entry of the sample */
+	if (accuracy < CONFIG_KWS_EVAL_MIN_ACCURACY) {
+		LOG_ERR("Evaluation failed, accuracy below %d%%", CONFIG_KWS_EVAL_MIN_ACCURACY);
+		return false;
+	}
+
+	LOG_INF("Evaluation passed, accuracy of at least %d%%", CONFIG_KWS_EVAL_MIN_ACCURACY);
+
+	return true;
+}
+
+} /* namespace app */
+} /* namespace alif */
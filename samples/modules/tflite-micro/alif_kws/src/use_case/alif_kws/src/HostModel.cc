@@ -0,0 +1,88 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "HostOptions.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(HostModel);
+
+namespace arm
+{
+namespace app
+{
+namespace kws
+{
+
+/* Model parameters, as the Vela model sources of alif_kws and alif_inference */
+extern const int g_FrameLength = 640;
+extern const int g_FrameStride = 320;
+extern const int g_AudioRate = 16000;
+extern const float g_ScoreThreshold = 0.5;
+
+/* The Vela model consists of the Ethos-U operator, which has no reference kernel. The host
+ * build reads the model it was compiled from. */
+static std::vector<uint8_t> model;
+
+static void LoadModel()
+{
+	const char *path = kws_host_model_file();
+	FILE *file = fopen(path, "rb");
+	long size = -1;
+
+	if (file && fseek(file, 0, SEEK_END) == 0) {
+		size = ftell(file);
+		rewind(file);
+	}
+
+	if (size > 0) {
+		model.resize(size);
+		if (fread(model.data(), 1, size, file) != static_cast<size_t>(size)) {
+			model.clear();
+		}
+	}
+
+	if (file) {
+		fclose(file);
+	}
+
+	if (model.empty()) {
+		LOG_ERR("Cannot read the model %s", path);
+		kws_host_exit(1);
+	}
+
+	LOG_INF("Model %s, %zu bytes", path, model.size());
+}
+
+const uint8_t *GetModelPointer()
+{
+	if (model.empty()) {
+		LoadModel();
+	}
+
+	return model.data();
+}
+
+/* Either may be called first, as arguments of the same call */
+size_t GetModelLen()
+{
+	if (model.empty()) {
+		LoadModel();
+	}
+
+	return model.size();
+}
+
+} /* namespace kws */
+} /* namespace app */
+} /* namespace arm */
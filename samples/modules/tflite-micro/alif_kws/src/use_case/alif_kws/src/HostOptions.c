@@ -0,0 +1,62 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "HostOptions.h"
+
+#include "cmdline.h"
+#include "posix_board_if.h"
+#include "soc.h"
+
+/* Evaluation data downloaded at build time, see cmake/kws_eval_data.cmake */
+#if defined(KWS_EVAL_MODEL_FILE)
+#define MODEL_FILE KWS_EVAL_MODEL_FILE
+#define CLIP_LIST  KWS_EVAL_CLIP_LIST
+#else
+#define MODEL_FILE CONFIG_KWS_HOST_MODEL_FILE
+#define CLIP_LIST  CONFIG_KWS_WAV_CLIP_LIST
+#endif
+
+static char *model_file = MODEL_FILE;
+static char *clip_list = CLIP_LIST;
+
+static void kws_host_options(void)
+{
+	static struct args_struct_t options[] = {
+		{.option = "kws_model",
+		 .name = "path",
+		 .type = 's',
+		 .dest = (void *)&model_file,
+		 .descript = "TFLite model run by the reference kernels, by default \"" MODEL_FILE "\""},
+		{.option = "kws_clips",
+		 .name = "path",
+		 .type = 's',
+		 .dest = (void *)&clip_list,
+		 .descript = "List of labelled WAV clips, by default \"" CLIP_LIST "\""},
+		ARG_TABLE_ENDMARKER,
+	};
+
+	native_add_command_line_opts(options);
+}
+
+NATIVE_TASK(kws_host_options, PRE_BOOT_1, 1);
+
+const char *kws_host_model_file(void)
+{
+	return model_file;
+}
+
+const char *kws_host_clip_list(void)
+{
+	return clip_list;
+}
+
+void kws_host_exit(int status)
+{
+	posix_exit(status);
+}
@@ -20,6 +20,10 @@
 #include "UseCaseHandler.hpp"     /* Handlers for different user options. */
 #include "BufAttributes.hpp"      /* Buffer attributes to be applied */
 
+#if defined(CONFIG_KWS_WAV_INPUT)
+#include "HostOptions.h"          /* Host build exit. */
+#endif
+
 #include <zephyr/console/console.h>
 #include <zephyr/logging/log.h>
 
@@ -42,6 +46,7 @@ extern const int g_AudioRate;
 enum opcodes {
 	MENU_OPT_RUN_ONCE = 1,
 	MENU_OPT_RUN_CONTINUOUS,
+	MENU_OPT_EVALUATE_CLIPS,
 };
 
 static void DisplayMenu()
@@ -50,6 +55,9 @@ static void DisplayMenu()
 	LOG_INF("Enter option number from:");
 	LOG_INF("%u. Run classification on one audio window", MENU_OPT_RUN_ONCE);
 	LOG_INF("%u. Run classification continuously", MENU_OPT_RUN_CONTINUOUS);
+#if defined(CONFIG_KWS_WAV_INPUT)
+	LOG_INF("%u. Evaluate the labelled clips", MENU_OPT_EVALUATE_CLIPS);
+#endif
 	LOG_INF("Choice:");
 	fflush(stdout);
 }
@@ -91,6 +99,15 @@ void main_loop()
 	constexpr bool bUseMenu = false;
 #endif
 
+#if defined(CONFIG_KWS_WAV_INPUT)
+	/* Host build: evaluate the clips once, the exit status tells whether it passed */
+	if (!bUseMenu) {
+		executionSuccessful = alif::app::EvaluateClipsHandler(caseContext);
+		LOG_INF("Main loop terminated.");
+		kws_host_exit(executionSuccessful ? 0 : 1);
+	}
+#endif
+
 	/* Loop. */
 	do {
 		int menuOption = MENU_OPT_RUN_CONTINUOUS;
@@ -105,6 +122,11 @@ void main_loop()
 		case MENU_OPT_RUN_CONTINUOUS:
 			executionSuccessful = alif::app::ClassifyAudioHandler(caseContext, false);
 			break;
+#if defined(CONFIG_KWS_WAV_INPUT)
+		case MENU_OPT_EVALUATE_CLIPS:
+			executionSuccessful = alif::app::EvaluateClipsHandler(caseContext);
+			break;
+#endif
 		default:
 			LOG_ERR("Incorrect choice, try again.");
 			break;
@@ -22,8 +22,15 @@
 #include "KwsResult.hpp"
 #include "KwsProcessing.hpp"
 
+#if defined(CONFIG_KWS_VAD)
+#include "ethosu/VoiceActivityDetector.h"
+#endif
+
+#include <errno.h>
+#include <string.h>
 #include <vector>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(UseCaseHandler);
@@ -33,6 +40,7 @@ using arm::app::ClassificationResult;
 using arm::app::KwsClassifier;
 using arm::app::KwsPostProcess;
 using arm::app::KwsPreProcess;
+using arm::app::KwsStreamingPreProcess;
 using arm::app::MicroNetKwsModel;
 using arm::app::Model;
 
@@ -40,6 +48,11 @@ using arm::app::Model;
 #define AUDIO_STRIDE   CONFIG_AUDIO_STRIDE
 #define RESULTS_MEMORY CONFIG_RESULTS_MEMORY
 
+/* Strides are captured in place, a whole number of them keeps every capture contiguous */
+BUILD_ASSERT(AUDIO_SAMPLES % AUDIO_STRIDE == 0,
+	     "CONFIG_AUDIO_SAMPLES must be a multiple of CONFIG_AUDIO_STRIDE");
+
+/* Inference window plus the stride being captured while the window is processed */
 static int16_t audio_inf[AUDIO_SAMPLES + AUDIO_STRIDE];
 
 namespace alif
@@ -59,10 +72,21 @@ using namespace arm::app::kws;
 
 /**
  * @brief           Presents KWS inference results.
- * @param[in]       results     Vector of KWS classification results to be displayed.
+ * @param[in]       results     Latest KWS classification results to be displayed.
+ * @param[in]       labels      Labels referenced by the results.
  * @return          true if successful, false otherwise.
  **/
-static bool PresentInferenceResult(const std::vector<arm::app::kws::KwsResult> &results);
+static bool PresentInferenceResult(const kws::KwsResultMemory<RESULTS_MEMORY> &results,
+				   const std::vector<std::string> &labels);
+
+#if defined(CONFIG_KWS_VAD)
+/**
+ * @brief           Logs the voice activity gate statistics.
+ * @param[in]       stats       Voice activity detector statistics.
+ * @param[in]       audioRate   Sampling rate, for the latencies.
+ **/
+static void PresentVadStats(const VoiceActivityDetector::Stats &stats, int audioRate);
+#endif
 
 /* KWS inference handler. */
 bool ClassifyAudioHandler(ApplicationContext &ctx, bool oneshot)
@@ -104,56 +128,111 @@ bool ClassifyAudioHandler(ApplicationContext &ctx, bool oneshot)
 	 *  NOTE: This is only used for time stamp calculation. */
 	const float secondsPerSample = 1.0f / audioRate;
 
-	/* Set up pre and post-processing. */
-	KwsPreProcess preProcess = KwsPreProcess(inputTensor, numMfccFeatures, numMfccFrames,
-						 mfccFrameLength, mfccFrameStride);
-
+	/* Set up pre and post-processing. The MFCC buffers are too large for the stack, the
+	 * model and so the MFCC parameters are the same on every call. */
+	static KwsStreamingPreProcess preProcess = KwsStreamingPreProcess(
+		inputTensor, numMfccFeatures, numMfccFrames, mfccFrameLength, mfccFrameStride);
+	preProcess.Reset();
+
+#if defined(CONFIG_KWS_VERIFY_STREAMING_MFCC)
+	/* Batch frontend writing into a shadow tensor, to check the streaming features */
+	std::vector<uint8_t> batchFeatures(inputTensor->bytes);
+	TfLiteTensor batchTensor = *inputTensor;
+	batchTensor.data.data = batchFeatures.data();
+	KwsPreProcess batchPreProcess = KwsPreProcess(&batchTensor, numMfccFeatures, numMfccFrames,
+						      mfccFrameLength, mfccFrameStride);
+#endif
+
+	const auto &labels = ctx.Get<std::vector<std::string> &>("labels");
 	std::vector<ClassificationResult> singleInfResult;
-	KwsPostProcess postProcess =
-		KwsPostProcess(outputTensor, ctx.Get<KwsClassifier &>("classifier"),
-			       ctx.Get<std::vector<std::string> &>("labels"), singleInfResult);
+	KwsPostProcess postProcess = KwsPostProcess(
+		outputTensor, ctx.Get<KwsClassifier &>("classifier"), labels, singleInfResult);
 
+	/* Results are kept in fixed storage, the loop does not allocate once running */
 	int index = 0;
-	std::vector<kws::KwsResult> infResults;
+	kws::KwsResultMemory<RESULTS_MEMORY> infResults;
 	int err = audio_init(audioRate);
 	if (err) {
 		LOG_ERR("hal_audio_init failed with error: %d", err);
 		return false;
 	}
 
-	// Start first fill of final stride section of buffer
-	get_audio_data(audio_inf + AUDIO_SAMPLES, AUDIO_STRIDE);
+	AudioRingBuffer<int16_t> audioRing(audio_inf, ARRAY_SIZE(audio_inf));
+
+#if defined(CONFIG_KWS_VAD)
+	/* 20 ms analysis frames */
+	VoiceActivityDetector::Config vadConfig;
+	vadConfig.frameLength = audioRate / 50;
+	vadConfig.snrDb = CONFIG_KWS_VAD_SNR_DB;
+	vadConfig.hangoverFrames = CONFIG_KWS_VAD_HANGOVER_MS / 20;
+	VoiceActivityDetector vad(vadConfig);
+	/* No features computed yet, statistics are logged when voice stops */
+	bool featuresStale = true;
+#endif
+
+	// Start first fill of the stride following the (initially silent) inference window
+	get_audio_data(audioRing.GetWritePointer(), AUDIO_STRIDE);
 
 	do {
 		// Wait until stride buffer is full - initiated above or by previous interation of
 		// loop
 		int err = wait_for_audio();
-		if (err) {
+		if (err == -ENODATA) {
+			/* Host build, all the WAV clips were read */
+			LOG_INF("End of the audio input");
+			break;
+		} else if (err) {
 			LOG_ERR("hal_get_audio_data failed with error: %d", err);
 			return false;
 		}
 
-		// move buffer down by one stride, clearing space at the end for the next stride
-		std::copy(audio_inf + AUDIO_STRIDE, audio_inf + AUDIO_STRIDE + AUDIO_SAMPLES,
-			  audio_inf);
+		// slide the window onto the new stride, the oldest stride becomes free for capture
+		audioRing.Commit(AUDIO_STRIDE);
 
 		// start receiving the next stride immediately before we start heavy processing, so
 		// as not to lose anything
-		get_audio_data(audio_inf + AUDIO_SAMPLES, AUDIO_STRIDE);
+		get_audio_data(audioRing.GetWritePointer(), AUDIO_STRIDE);
 
-		audio_preprocessing(audio_inf + AUDIO_SAMPLES - AUDIO_STRIDE, AUDIO_STRIDE);
+		const AudioRingWindow<int16_t> inferenceWindow = audioRing.GetWindow(AUDIO_SAMPLES);
 
-		const int16_t *inferenceWindow = audio_inf;
+#if defined(CONFIG_KWS_VAD)
+		/* Continuous classification only runs while voice is active, the one shot always.
+		 * Captures never wrap, the new stride is contiguous. */
+		if (!vad.Process(inferenceWindow.Data(AUDIO_SAMPLES - AUDIO_STRIDE), AUDIO_STRIDE) &&
+		    !oneshot) {
+			if (!featuresStale) {
+				PresentVadStats(vad.GetStats(), audioRate);
+			}
+			featuresStale = true;
+			++index;
+			continue;
+		}
+
+		/* The features of the skipped strides were not computed */
+		if (featuresStale) {
+			preProcess.Reset();
+			featuresStale = false;
+		}
+#endif
 
 		uint32_t start = k_cycle_get_32();
 		/* Run the pre-processing, inference and post-processing. */
-		if (!preProcess.DoPreProcess(inferenceWindow, index)) {
+		if (!preProcess.DoPreProcess(inferenceWindow, AUDIO_STRIDE)) {
 			LOG_ERR("Pre-processing failed.");
 			return false;
 		}
 		LOG_INF("Preprocessing time = %.3f ms",
 		       (double)(k_cycle_get_32() - start) / sys_clock_hw_cycles_per_sec() * 1000);
 
+#if defined(CONFIG_KWS_VERIFY_STREAMING_MFCC)
+		/* Inference index 0 bypasses the feature cache, every frame is recomputed */
+		if (!batchPreProcess.DoPreProcess(inferenceWindow, 0) ||
+		    memcmp(batchFeatures.data(), inputTensor->data.data, inputTensor->bytes) != 0) {
+			LOG_ERR("Streaming MFCC features differ from the batch frontend.");
+			return false;
+		}
+#endif
+
 		start = k_cycle_get_32();
 		if (!model.RunInference()) {
 			LOG_ERR("Inference failed.");
@@ -170,19 +249,16 @@ bool ClassifyAudioHandler(ApplicationContext &ctx, bool oneshot)
 		LOG_INF("Postprocessing time = %.3f ms",
 		       (double)(k_cycle_get_32() - start) / sys_clock_hw_cycles_per_sec() * 1000);
 
-		/* Add results from this window to our final results vector. */
-		if (infResults.size() == RESULTS_MEMORY) {
-			infResults.erase(infResults.begin());
-		}
-		infResults.emplace_back(kws::KwsResult(
-			singleInfResult, index * secondsPerSample * preProcess.m_audioDataStride,
-			index, scoreThreshold));
+		/* Add results from this window to our final results, replacing the oldest. */
+		infResults.Push(kws::KwsResult(singleInfResult,
+					       index * secondsPerSample * AUDIO_STRIDE, index,
+					       scoreThreshold));
 
 #if VERIFY_TEST_OUTPUT
 		DumpTensor(outputTensor);
 #endif /* VERIFY_TEST_OUTPUT */
 
-		if (!PresentInferenceResult(infResults)) {
+		if (!PresentInferenceResult(infResults, labels)) {
 			return false;
 		}
 
@@ -194,32 +270,27 @@ bool ClassifyAudioHandler(ApplicationContext &ctx, bool oneshot)
 	return true;
 }
 
-static bool PresentInferenceResult(const std::vector<kws::KwsResult> &results)
+static bool PresentInferenceResult(const kws::KwsResultMemory<RESULTS_MEMORY> &results,
+				   const std::vector<std::string> &labels)
 {
 	LOG_INF("Final results:");
-	LOG_INF("Total number of inferences: %zu", results.size());
+	LOG_INF("Total number of inferences: %zu", results.Size());
 
-	for (const auto &result : results) {
+	for (size_t i = 0; i < results.Size(); ++i) {
+		const auto &result = results[i];
 
-		std::string topKeyword{"<none>"};
-		float score = 0.f;
-		if (!result.m_resultVec.empty()) {
-			topKeyword = result.m_resultVec[0].m_label;
-			score = result.m_resultVec[0].m_normalisedVal;
-		}
-
-		if (result.m_resultVec.empty()) {
+		if (result.m_numResults == 0) {
 			LOG_INF("For timestamp: %f (inference #: %" PRIu32
 			     "); label: %s; threshold: %f",
 			     (double)result.m_timeStamp, result.m_inferenceNumber,
-			     topKeyword.c_str(), (double)result.m_threshold);
+			     "<none>", (double)result.m_threshold);
 		} else {
-			for (uint32_t j = 0; j < result.m_resultVec.size(); ++j) {
+			for (uint32_t j = 0; j < result.m_numResults; ++j) {
 				LOG_INF("For timestamp: %f (inference #: %" PRIu32
 				     "); label: %s, score: %f; threshold: %f",
 				     (double)result.m_timeStamp, result.m_inferenceNumber,
-				     result.m_resultVec[j].m_label.c_str(),
-				     result.m_resultVec[j].m_normalisedVal,
+				     labels[result.m_results[j].m_labelIdx].c_str(),
+				     result.m_results[j].m_normalisedVal,
 				     (double)result.m_threshold);
 			}
 		}
@@ -228,5 +299,21 @@ static bool PresentInferenceResult(const std::vector<kws::KwsResult> &results)
 	return true;
 }
 
+#if defined(CONFIG_KWS_VAD)
+static void PresentVadStats(const VoiceActivityDetector::Stats &stats, int audioRate)
+{
+	const uint32_t skipped = stats.blocks - stats.activeBlocks;
+	const uint32_t meanLatency =
+		stats.onsets ? static_cast<uint32_t>(stats.onsetLatencySum / stats.onsets) : 0;
+
+	LOG_INF("VAD: %" PRIu32 " of %" PRIu32 " strides skipped (%" PRIu32 "%%), %" PRIu32
+		" onsets",
+		skipped, stats.blocks, stats.blocks ? skipped * 100 / stats.blocks : 0,
+		stats.onsets);
+	LOG_INF("VAD: onset latency mean %" PRIu32 " ms, max %" PRIu32 " ms",
+		meanLatency * 1000 / audioRate, stats.onsetLatencyMax * 1000 / audioRate);
+}
+#endif
+
 } /* namespace app */
 } /* namespace alif */
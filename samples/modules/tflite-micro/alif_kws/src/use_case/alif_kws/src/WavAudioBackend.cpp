@@ -0,0 +1,288 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "AudioBackend.hpp"
+#include "HostOptions.h"
+#include "WavAudioBackend.hpp"
+#include "ethosu/AudioDownmix.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(WavAudioBackend);
+
+/* Frames converted per read */
+#define READ_FRAMES 256
+
+static FILE *clip_list;
+static char list_dir[256];
+static int sample_rate;
+
+static FILE *clip_file;
+static uint16_t clip_channels;
+static uint32_t clip_remaining;
+/* Clips are read one at a time, see wav_next_clip() */
+static bool clip_mode;
+
+static int capture_status = -EINVAL;
+
+static uint32_t read_le(const uint8_t *bytes, int size)
+{
+	uint32_t value = 0;
+
+	for (int i = size - 1; i >= 0; i--) {
+		value = (value << 8) | bytes[i];
+	}
+
+	return value;
+}
+
+/* Check the format and move to the samples, at clip_remaining frames of clip_channels */
+static int parse_wav_header(FILE *file, const char *path)
+{
+	uint8_t header[16];
+	bool format_found = false;
+
+	if (fread(header, 1, 12, file) != 12 || memcmp(header, "RIFF", 4) != 0 ||
+	    memcmp(header + 8, "WAVE", 4) != 0) {
+		LOG_ERR("%s: not a WAV file", path);
+		return -EINVAL;
+	}
+
+	while (fread(header, 1, 8, file) == 8) {
+		const uint32_t size = read_le(header + 4, 4);
+
+		if (memcmp(header, "fmt ", 4) == 0) {
+			if (size < 16 || fread(header, 1, 16, file) != 16) {
+				break;
+			}
+
+			const uint32_t format = read_le(header, 2);
+			const uint32_t rate = read_le(header + 4, 4);
+			const uint32_t bits = read_le(header + 14, 2);
+
+			clip_channels = read_le(header + 2, 2);
+
+			/* PCM, or WAVE_FORMAT_EXTENSIBLE */
+			if ((format != 1 && format != 0xfffe) || bits != 16 ||
+			    (clip_channels != 1 && clip_channels != 2)) {
+				LOG_ERR("%s: 16-bit PCM mono or stereo only", path);
+				return -ENOTSUP;
+			}
+
+			if (rate != static_cast<uint32_t>(sample_rate)) {
+				LOG_ERR("%s: sampled at %u Hz, %d Hz expected", path, rate,
+					sample_rate);
+				return -ENOTSUP;
+			}
+
+			format_found = true;
+			fseek(file, (size - 16) + (size & 1), SEEK_CUR);
+		} else if (memcmp(header, "data", 4) == 0) {
+			if (!format_found) {
+				break;
+			}
+
+			clip_remaining = size / (clip_channels * sizeof(int16_t));
+			return 0;
+		} else {
+			fseek(file, size + (size & 1), SEEK_CUR);
+		}
+	}
+
+	LOG_ERR("%s: no format or data chunk", path);
+	return -EINVAL;
+}
+
+static int open_next_clip(struct wav_clip *clip)
+{
+	char line[256];
+	char path[256];
+	char label[32];
+
+	if (clip_file) {
+		fclose(clip_file);
+		clip_file = NULL;
+	}
+	clip_remaining = 0;
+
+	/* Next line holding a path, "<path> [label]", # starts a comment */
+	int fields = 0;
+
+	while (fields < 1) {
+		if (!fgets(line, sizeof(line), clip_list)) {
+			return -ENODATA;
+		}
+		label[0] = '\0';
+		fields = line[0] == '#' ? 0 : sscanf(line, "%255s %31s", path, label);
+	}
+
+	if (fields < 2) {
+		const char *slash = strchr(path, '/');
+		const size_t length = slash ? MIN(static_cast<size_t>(slash - path),
+						  sizeof(label) - 1)
+					    : 0;
+
+		memcpy(label, path, length);
+		label[length] = '\0';
+	}
+
+	/* Paths are relative to the list */
+	char full_path[sizeof(wav_clip::path)];
+	const int written = snprintf(full_path, sizeof(full_path), "%s%s",
+				     path[0] == '/' ? "" : list_dir, path);
+
+	if (clip) {
+		strcpy(clip->path, full_path);
+		strcpy(clip->label, label);
+	}
+
+	if (written >= static_cast<int>(sizeof(full_path))) {
+		LOG_ERR("%s: path too long", path);
+		return -ENAMETOOLONG;
+	}
+
+	clip_file = fopen(full_path, "rb");
+	if (!clip_file) {
+		LOG_ERR("%s: cannot open", full_path);
+		return -ENOENT;
+	}
+
+	const int err = parse_wav_header(clip_file, full_path);
+
+	if (err) {
+		fclose(clip_file);
+		clip_file = NULL;
+		return err;
+	}
+
+	if (clip) {
+		clip->samples = clip_remaining;
+	}
+
+	return 0;
+}
+
+static int read_samples(int16_t *data, int len)
+{
+	int16_t frames[READ_FRAMES * 2];
+	int filled = 0;
+
+	while (filled < len) {
+		if (clip_remaining == 0) {
+			/* Clips are padded with silence in clip mode */
+			if (clip_mode) {
+				break;
+			}
+
+			const int err = open_next_clip(NULL);
+
+			if (err == -ENODATA) {
+				if (filled == 0) {
+					return err;
+				}
+				break;
+			}
+			/* Clips that cannot be read are skipped when streaming */
+			continue;
+		}
+
+		const size_t count = MIN(MIN(static_cast<uint32_t>(len - filled), clip_remaining),
+					 READ_FRAMES);
+
+		if (fread(frames, clip_channels * sizeof(int16_t), count, clip_file) != count) {
+			LOG_ERR("Truncated WAV data");
+			clip_remaining = 0;
+			continue;
+		}
+
+		if (clip_channels == 2) {
+			AudioDownmixStereo(frames, data + filled, count, 1);
+		} else {
+			memcpy(data + filled, frames, count * sizeof(int16_t));
+		}
+
+		filled += count;
+		clip_remaining -= count;
+	}
+
+	memset(data + filled, 0, (len - filled) * sizeof(int16_t));
+
+	return 0;
+}
+
+int audio_init(int sampling_rate)
+{
+	const char *list = kws_host_clip_list();
+	const char *slash = strrchr(list, '/');
+	const size_t dir_length = slash ? MIN(static_cast<size_t>(slash - list + 1),
+					      sizeof(list_dir) - 1)
+					: 0;
+
+	LOG_DBG("Audio init, sampling rate %d, clips from %s", sampling_rate, list);
+
+	clip_list = fopen(list, "r");
+	if (!clip_list) {
+		LOG_ERR("Cannot open the clip list %s", list);
+		return -ENOENT;
+	}
+
+	memcpy(list_dir, list, dir_length);
+	list_dir[dir_length] = '\0';
+	sample_rate = sampling_rate;
+	clip_remaining = 0;
+	clip_mode = false;
+
+	return 0;
+}
+
+void audio_uninit(void)
+{
+	if (clip_file) {
+		fclose(clip_file);
+		clip_file = NULL;
+	}
+
+	if (clip_list) {
+		fclose(clip_list);
+		clip_list = NULL;
+	}
+}
+
+int get_audio_data(int16_t *data, int len)
+{
+	/* Files are read synchronously, wait_for_audio() returns the outcome */
+	capture_status = clip_list ? read_samples(data, len) : -EINVAL;
+
+	return 0;
+}
+
+int wait_for_audio(void)
+{
+	const int status = capture_status;
+
+	capture_status = -EINVAL;
+
+	return status;
+}
+
+int wav_next_clip(struct wav_clip *clip)
+{
+	if (!clip_list) {
+		return -EINVAL;
+	}
+
+	clip_mode = true;
+	memset(clip, 0, sizeof(*clip));
+
+	return open_next_clip(clip);
+}
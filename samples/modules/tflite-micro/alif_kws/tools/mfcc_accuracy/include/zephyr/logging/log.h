@@ -0,0 +1,23 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+/* Host replacement of the Zephyr logging API used by the MFCC sources. */
+
+#ifndef ZEPHYR_LOGGING_LOG_H
+#define ZEPHYR_LOGGING_LOG_H
+
+#include <stdio.h>
+
+#define LOG_MODULE_REGISTER(...)
+#define LOG_ERR(fmt, ...) fprintf(stderr, "error: " fmt "\n", ##__VA_ARGS__)
+#define LOG_WRN(fmt, ...) fprintf(stderr, "warning: " fmt "\n", ##__VA_ARGS__)
+#define LOG_INF(fmt, ...) printf(fmt "\n", ##__VA_ARGS__)
+#define LOG_DBG(...)
+
+#endif /* ZEPHYR_LOGGING_LOG_H */
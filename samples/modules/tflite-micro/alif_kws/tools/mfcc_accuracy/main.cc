@@ -0,0 +1,277 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+/*
+ * Compares the fixed-point MFCC (MfccQ15) against the float MFCC on 16 kHz mono
+ * 16-bit WAV clips, or on a built-in synthetic corpus when no clip is given.
+ * Frames are taken as in the KWS use case (640 samples, 320 sample stride).
+ *
+ * Usage: mfcc_accuracy [--scale <s>] [--offset <o>] [clip.wav ...]
+ *
+ * Reports per clip the feature error (float units) and the int8 differences with the
+ * given input quantisation.
+ */
+
+#include "MicroNetKwsMfcc.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using arm::app::audio::MicroNetKwsMFCC;
+using arm::app::audio::MicroNetKwsMfccQ15;
+
+namespace
+{
+constexpr size_t numFeatures = 10;
+constexpr size_t frameLength = 640;
+constexpr size_t frameStride = 320;
+constexpr uint32_t sampleRate = 16000;
+
+struct Clip {
+	std::string name;
+	std::vector<int16_t> samples;
+};
+
+struct Stats {
+	size_t frames = 0;
+	double maxError = 0;
+	double sumSquaredError = 0;
+	size_t values = 0;
+	size_t int8Mismatches = 0;
+	int maxInt8Diff = 0;
+
+	void Add(const Stats &other)
+	{
+		frames += other.frames;
+		maxError = std::max(maxError, other.maxError);
+		sumSquaredError += other.sumSquaredError;
+		values += other.values;
+		int8Mismatches += other.int8Mismatches;
+		maxInt8Diff = std::max(maxInt8Diff, other.maxInt8Diff);
+	}
+};
+
+uint32_t ReadLe(const uint8_t *p, size_t bytes)
+{
+	uint32_t value = 0;
+
+	for (size_t i = 0; i < bytes; i++) {
+		value |= static_cast<uint32_t>(p[i]) << (8 * i);
+	}
+
+	return value;
+}
+
+bool ReadWav(const char *path, Clip &clip)
+{
+	FILE *f = fopen(path, "rb");
+
+	if (f == nullptr) {
+		fprintf(stderr, "%s: cannot open\n", path);
+		return false;
+	}
+
+	std::vector<uint8_t> data;
+	uint8_t buf[4096];
+	size_t n;
+
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+		data.insert(data.end(), buf, buf + n);
+	}
+	fclose(f);
+
+	if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 ||
+	    memcmp(data.data() + 8, "WAVE", 4) != 0) {
+		fprintf(stderr, "%s: not a WAV file\n", path);
+		return false;
+	}
+
+	uint32_t channels = 0;
+	uint32_t bits = 0;
+
+	for (size_t pos = 12; pos + 8 <= data.size();) {
+		const uint8_t *chunk = data.data() + pos;
+		const uint32_t size = ReadLe(chunk + 4, 4);
+		const size_t body = pos + 8;
+
+		if (body + size > data.size()) {
+			break;
+		}
+
+		if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+			const uint32_t format = ReadLe(chunk + 8, 2);
+			const uint32_t rate = ReadLe(chunk + 12, 4);
+
+			channels = ReadLe(chunk + 10, 2);
+			bits = ReadLe(chunk + 22, 2);
+
+			if (format != 1 || bits != 16 || channels == 0) {
+				fprintf(stderr, "%s: only 16-bit PCM is supported\n", path);
+				return false;
+			}
+			if (rate != sampleRate) {
+				fprintf(stderr, "%s: warning, %u Hz clip, features assume %u Hz\n",
+					path, rate, sampleRate);
+			}
+		} else if (memcmp(chunk, "data", 4) == 0 && channels != 0) {
+			/* First channel only. */
+			for (size_t i = 0; i + 2 * channels <= size; i += 2 * channels) {
+				clip.samples.push_back(
+					static_cast<int16_t>(ReadLe(data.data() + body + i, 2)));
+			}
+			clip.name = path;
+			return true;
+		}
+
+		pos = body + size + (size & 1);
+	}
+
+	fprintf(stderr, "%s: no PCM data\n", path);
+	return false;
+}
+
+Clip Synthetic(const char *name, float amplitude, float freqStart, float freqEnd, float noise)
+{
+	std::mt19937 rng(1);
+	std::normal_distribution<float> gaussian(0.0f, 1.0f);
+	Clip clip{name, std::vector<int16_t>(sampleRate)};
+	double phase = 0;
+
+	for (size_t i = 0; i < clip.samples.size(); i++) {
+		const double t = static_cast<double>(i) / sampleRate;
+		const double freq = freqStart + (freqEnd - freqStart) * t;
+		const float value = amplitude * static_cast<float>(std::sin(phase)) +
+				    noise * gaussian(rng);
+
+		phase += 2 * M_PI * freq / sampleRate;
+		clip.samples[i] = static_cast<int16_t>(
+			std::lround(std::fmax(std::fmin(value * 32767.0f, 32767.0f), -32768.0f)));
+	}
+
+	return clip;
+}
+
+std::vector<Clip> SyntheticCorpus()
+{
+	return {
+		Synthetic("silence", 0.0f, 0, 0, 0.0f),
+		Synthetic("tone 1 kHz -6 dBFS", 0.5f, 1000, 1000, 0.0f),
+		Synthetic("tone 1 kHz -40 dBFS", 0.01f, 1000, 1000, 0.0f),
+		Synthetic("tone 300 Hz -60 dBFS", 0.001f, 300, 300, 0.0f),
+		Synthetic("noise -20 dBFS", 0.0f, 0, 0, 0.1f),
+		Synthetic("noise -60 dBFS", 0.0f, 0, 0, 0.001f),
+		Synthetic("chirp 100 Hz-4 kHz -12 dBFS", 0.25f, 100, 4000, 0.0f),
+		Synthetic("chirp in noise", 0.1f, 200, 3000, 0.03f),
+	};
+}
+
+Stats Compare(const Clip &clip, MicroNetKwsMFCC &mfcc, MicroNetKwsMfccQ15 &mfccQ15, float scale,
+	      int offset)
+{
+	Stats stats;
+	std::vector<int16_t> frame(frameLength);
+	int32_t fixedFeatures[numFeatures];
+	int8_t fixedQuant[numFeatures];
+
+	for (size_t start = 0; start + frameLength <= clip.samples.size(); start += frameStride) {
+		std::copy_n(clip.samples.begin() + start, frameLength, frame.begin());
+
+		const std::vector<float> floatFeatures = mfcc.MfccCompute(frame);
+		const std::vector<int8_t> floatQuant =
+			mfcc.MfccComputeQuant<int8_t>(frame, scale, offset);
+
+		mfccQ15.MfccCompute(frame.data(), fixedFeatures);
+		mfccQ15.MfccComputeQuant(frame.data(), fixedQuant);
+
+		for (size_t i = 0; i < numFeatures; i++) {
+			const double error =
+				std::fabs(fixedFeatures[i] / 65536.0 - floatFeatures[i]);
+			const int int8Diff = std::abs(fixedQuant[i] - floatQuant[i]);
+
+			stats.maxError = std::max(stats.maxError, error);
+			stats.sumSquaredError += error * error;
+			stats.int8Mismatches += int8Diff != 0;
+			stats.maxInt8Diff = std::max(stats.maxInt8Diff, int8Diff);
+		}
+
+		stats.values += numFeatures;
+		stats.frames++;
+	}
+
+	return stats;
+}
+
+void PrintStats(const char *name, const Stats &stats)
+{
+	const double rms = stats.values ? std::sqrt(stats.sumSquaredError / stats.values) : 0;
+	const double mismatches =
+		stats.values ? 100.0 * stats.int8Mismatches / stats.values : 0;
+
+	printf("%-32s %7zu %10.4f %10.4f %9.2f%% %6d\n", name, stats.frames, stats.maxError, rms,
+	       mismatches, stats.maxInt8Diff);
+}
+} /* namespace */
+
+int main(int argc, char **argv)
+{
+	float scale = 1.0f;
+	int offset = 0;
+	std::vector<Clip> clips;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--scale") == 0 && i + 1 < argc) {
+			scale = strtof(argv[++i], nullptr);
+		} else if (strcmp(argv[i], "--offset") == 0 && i + 1 < argc) {
+			offset = atoi(argv[++i]);
+		} else {
+			Clip clip;
+
+			if (!ReadWav(argv[i], clip)) {
+				return EXIT_FAILURE;
+			}
+			clips.push_back(std::move(clip));
+		}
+	}
+
+	if (clips.empty()) {
+		clips = SyntheticCorpus();
+	}
+
+	MicroNetKwsMFCC mfcc(numFeatures, frameLength);
+	MicroNetKwsMfccQ15 mfccQ15(numFeatures, frameLength);
+
+	mfcc.Init();
+	if (!mfccQ15.Init()) {
+		return EXIT_FAILURE;
+	}
+	mfccQ15.SetQuantisation(scale, offset);
+
+	printf("int8 quantisation: scale %g, offset %d\n", scale, offset);
+	printf("%-32s %7s %10s %10s %10s %6s\n", "clip", "frames", "max_err", "rms_err",
+	       "int8_diff", "max");
+
+	Stats total;
+
+	for (const Clip &clip : clips) {
+		const Stats stats = Compare(clip, mfcc, mfccQ15, scale, offset);
+
+		PrintStats(clip.name.c_str(), stats);
+		total.Add(stats);
+	}
+
+	PrintStats("total", total);
+
+	return EXIT_SUCCESS;
+}
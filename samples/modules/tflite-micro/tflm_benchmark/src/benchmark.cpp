@@ -0,0 +1,239 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "benchmark.hpp"
+
+#include "arena_planner.hpp"
+#include "inference_process.hpp"
+#include "model_placement.hpp"
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+#include "layer_profiler.hpp"
+#endif
+
+#include <algorithm>
+#include <inttypes.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/kernel.h>
+
+using namespace InferenceProcess;
+
+namespace
+{
+struct MemoryRegion {
+	const char *name;
+	uintptr_t start;
+	size_t size;
+};
+
+#define MEMORY_REGION(name, node) { name, DT_REG_ADDR(node), DT_REG_SIZE(node) },
+
+/* Checked in order, the TCMs may be part of the chosen SRAM */
+const MemoryRegion memoryRegions[] = {
+#if DT_HAS_CHOSEN(zephyr_itcm)
+	MEMORY_REGION("itcm", DT_CHOSEN(zephyr_itcm))
+#endif
+#if DT_HAS_CHOSEN(zephyr_dtcm)
+	MEMORY_REGION("dtcm", DT_CHOSEN(zephyr_dtcm))
+#endif
+#if DT_HAS_CHOSEN(zephyr_sram)
+	MEMORY_REGION("sram", DT_CHOSEN(zephyr_sram))
+#endif
+#if DT_HAS_CHOSEN(zephyr_flash)
+	MEMORY_REGION("flash", DT_CHOSEN(zephyr_flash))
+#endif
+#if DT_NODE_EXISTS(DT_NODELABEL(ext_flash_xip))
+	MEMORY_REGION("ext_flash_xip", DT_NODELABEL(ext_flash_xip))
+#endif
+	{ "other", 0, 0 },
+};
+
+uint32_t cyclesToUs(uint32_t cycles)
+{
+	return static_cast<uint32_t>(static_cast<uint64_t>(cycles) * 1000000 /
+				     sys_clock_hw_cycles_per_sec());
+}
+
+uint32_t inferencesPerSecond(uint32_t cycles)
+{
+	return cycles != 0 ? sys_clock_hw_cycles_per_sec() / cycles : 0;
+}
+
+/* Timed samples, static to keep them off the stack */
+uint32_t samples[CONFIG_BENCHMARK_ITERATIONS];
+
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+LayerProfiler profiler;
+
+/* Run one profiled inference and sum the NPU active cycles of all NPU operators */
+bool measureNpuActive(class InferenceProcess::InferenceProcess &process, InferenceJob &job,
+		      uint64_t &npuActive)
+{
+	process.setProfiler(&profiler);
+	profiler.reset();
+
+	const bool failed = process.runJob(job);
+
+	npuActive = 0;
+	for (size_t i = 0; i < profiler.getEventCount(); i++) {
+		const LayerProfiler::Event &event = profiler.getEvent(i);
+
+		if (event.npu) {
+			/* First PMU counter counts NPU_ACTIVE */
+			npuActive += event.pmuCounters[0];
+		}
+	}
+
+	process.setProfiler(nullptr);
+
+	return failed;
+}
+#endif
+
+} /* namespace */
+
+void computeLatencyStats(uint32_t *_samples, size_t count, LatencyStats &stats)
+{
+	stats = {};
+
+	if (count == 0) {
+		return;
+	}
+
+	std::sort(_samples, _samples + count);
+
+	stats.min = _samples[0];
+	stats.max = _samples[count - 1];
+
+	if (count % 2 != 0) {
+		stats.median = _samples[count / 2];
+	} else {
+		stats.median = static_cast<uint32_t>(
+			(static_cast<uint64_t>(_samples[count / 2 - 1]) + _samples[count / 2]) / 2);
+	}
+
+	/* Nearest rank: smallest sample with at least 99% of the samples at or below it */
+	stats.p99 = _samples[(count * 99 + 99) / 100 - 1];
+}
+
+const char *memoryPlacement(const void *address)
+{
+	const uintptr_t addr = reinterpret_cast<uintptr_t>(address);
+
+	for (const MemoryRegion &region : memoryRegions) {
+		if (addr >= region.start && addr - region.start < region.size) {
+			return region.name;
+		}
+	}
+
+	return "other";
+}
+
+bool runBenchmark(const BenchmarkModel &model, uint8_t *arena, size_t arenaSize,
+		  ModelPool &modelPool, BenchmarkResult &result)
+{
+	result = {};
+
+	/* Models are benchmarked one at a time, no session uses the pool anymore */
+	modelPool.reset();
+	if (modelPool.place(model.networkModel, model.placement, result.placedModel)) {
+		return true;
+	}
+
+	const DataPtr &networkModel = result.placedModel;
+
+	result.modelPlacement = memoryPlacement(networkModel.data);
+	result.arenaPlacement = memoryPlacement(arena);
+
+	/* Measure the arena need before the session, the planner uses the arena itself */
+	ArenaPlanner planner(arena, arenaSize);
+	if (planner.addModel(networkModel) || planner.plan()) {
+		result.skipped = true;
+		return false;
+	}
+
+	result.arenaUsed = planner.getPeak();
+
+	class InferenceProcess::InferenceProcess process(arena, arenaSize);
+	if (process.openSession(networkModel)) {
+		result.skipped = true;
+		return false;
+	}
+
+	InferenceJob job(model.name, networkModel, { model.input }, {},
+			 { model.expectedOutput });
+	job.expectedOutputTolerance = model.expectedOutputTolerance;
+
+	/* The first warmup run also verifies the output */
+	if (process.runJob(job)) {
+		printk("%s: Inference or output check failed\n", model.name);
+		return true;
+	}
+
+	job.expectedOutput.clear();
+
+	for (int i = 1; i < CONFIG_BENCHMARK_WARMUP; i++) {
+		if (process.runJob(job)) {
+			return true;
+		}
+	}
+
+	for (size_t i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		const uint32_t start = k_cycle_get_32();
+
+		if (process.runJob(job)) {
+			return true;
+		}
+
+		samples[i] = k_cycle_get_32() - start;
+	}
+
+	result.iterations = CONFIG_BENCHMARK_ITERATIONS;
+	computeLatencyStats(samples, CONFIG_BENCHMARK_ITERATIONS, result.cycles);
+
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+	if (measureNpuActive(process, job, result.npuActiveCycles)) {
+		return true;
+	}
+#endif
+
+	return false;
+}
+
+void printResultHeader()
+{
+	printk("%-32s %-14s %5s %10s %10s %10s %10s %9s %6s %12s %9s %-13s %-13s %s\n", "model",
+	       "npu", "iters", "min_cyc", "median_cyc", "p99_cyc", "max_cyc", "median_us",
+	       "inf/s", "npu_active", "arena", "model_mem", "arena_mem", "policy");
+}
+
+void printResult(const BenchmarkModel &model, const BenchmarkResult &result)
+{
+	if (result.skipped) {
+		printk("%-32s %-14s skipped, model cannot be loaded (needs the NPU?)\n", model.name,
+		       model.npuConfig);
+		return;
+	}
+
+	printk("%-32s %-14s %5" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32
+	       " %9" PRIu32 " %6" PRIu32 " %12" PRIu64 " %9zu %-13s %-13s %s\n",
+	       model.name, model.npuConfig, result.iterations, result.cycles.min,
+	       result.cycles.median, result.cycles.p99, result.cycles.max,
+	       cyclesToUs(result.cycles.median), inferencesPerSecond(result.cycles.median),
+	       result.npuActiveCycles, result.arenaUsed, result.modelPlacement,
+	       result.arenaPlacement, placementName(model.placement));
+
+#if defined(CONFIG_BENCHMARK_CSV)
+	printk("csv,%s,%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu64
+	       ",%zu,%s,%s,%s\n",
+	       model.name, model.npuConfig, result.iterations, result.cycles.min,
+	       result.cycles.median, result.cycles.p99, result.cycles.max,
+	       result.npuActiveCycles, result.arenaUsed, result.modelPlacement,
+	       result.arenaPlacement, placementName(model.placement));
+#endif
+}
@@ -0,0 +1,58 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include "models.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct LatencyStats {
+	uint32_t min;
+	uint32_t median;
+	uint32_t p99;
+	uint32_t max;
+};
+
+struct BenchmarkResult {
+	/* Model could not be loaded, e.g. NPU operator on a host build */
+	bool skipped;
+	/* Output did not match the expected output */
+	bool mismatch;
+	uint32_t iterations;
+	LatencyStats cycles;
+	/* Ethos-U PMU NPU_ACTIVE count of one inference, 0 without profiler */
+	uint64_t npuActiveCycles;
+	/* Arena bytes used by the model, persistent and non-persistent */
+	size_t arenaUsed;
+	/* Model as benchmarked, possibly copied to the SRAM pool */
+	InferenceProcess::DataPtr placedModel;
+	const char *modelPlacement;
+	const char *arenaPlacement;
+};
+
+/* Sort the samples in place and reduce them to min/median/p99/max */
+void computeLatencyStats(uint32_t *samples, size_t count, LatencyStats &stats);
+
+/* Memory region holding the address, for the placement report */
+const char *memoryPlacement(const void *address);
+
+/*
+ * Places the model according to its policy (the pool is reset first), then
+ * runs it CONFIG_BENCHMARK_WARMUP times untimed, checking the output of
+ * the first run, then CONFIG_BENCHMARK_ITERATIONS times timed.
+ * Returns true on failure. A model that cannot be loaded is reported as
+ * skipped and does not fail the benchmark.
+ */
+bool runBenchmark(const BenchmarkModel &model, uint8_t *arena, size_t arenaSize,
+		  InferenceProcess::ModelPool &modelPool, BenchmarkResult &result);
+
+void printResultHeader();
+void printResult(const BenchmarkModel &model, const BenchmarkResult &result);
@@ -0,0 +1,50 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "benchmark.hpp"
+#include "models.hpp"
+
+#include <zephyr/kernel.h>
+
+using namespace InferenceProcess;
+
+int main(void)
+{
+	const BenchmarkModel *models;
+	const size_t count = getBenchmarkModels(&models);
+	int failed = 0;
+
+	ModelPool modelPool(benchmarkModelPool, CONFIG_BENCHMARK_MODEL_POOL_SIZE);
+
+	printk("TFLM benchmark: %zu models, warmup=%d, iterations=%d, arena=%zu, cpu_hz=%u\n",
+	       count, CONFIG_BENCHMARK_WARMUP, CONFIG_BENCHMARK_ITERATIONS, benchmarkArenaSize,
+	       sys_clock_hw_cycles_per_sec());
+#if defined(CONFIG_BENCHMARK_CSV)
+	printk("csv,model,npu,iterations,min_cycles,median_cycles,p99_cycles,max_cycles,"
+	       "npu_active_cycles,arena_bytes,model_mem,arena_mem,policy\n");
+#endif
+
+	printResultHeader();
+
+	for (size_t i = 0; i < count; i++) {
+		BenchmarkResult result;
+
+		if (runBenchmark(models[i], benchmarkArena, benchmarkArenaSize, modelPool, result)) {
+			printk("%s: benchmark failed\n", models[i].name);
+			failed++;
+			continue;
+		}
+
+		printResult(models[i], result);
+	}
+
+	printk("Benchmark done: failed=%d\n", failed);
+
+	return failed;
+}
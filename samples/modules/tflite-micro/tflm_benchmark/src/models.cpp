@@ -0,0 +1,111 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "models.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+using namespace InferenceProcess;
+
+/*
+ * The model headers define unscoped symbols (modelName, networkModelData,
+ * inputData, ...) and TENSOR_ARENA_SIZE, so every model gets a namespace.
+ */
+namespace kws
+{
+#if defined(BENCHMARK_ETHOSU_U85)
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u85/input.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u85/output.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u85/model_u85_256.h"
+constexpr const char *npuConfig = "ethos-u85-256";
+#elif defined(BENCHMARK_ETHOSU_U55_256)
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/input.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/output.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/model_u55_256.h"
+constexpr const char *npuConfig = "ethos-u55-256";
+#else
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/input.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/output.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/model_u55_128.h"
+constexpr const char *npuConfig = "ethos-u55-128";
+#endif
+constexpr size_t arenaSize = TENSOR_ARENA_SIZE;
+#undef TENSOR_ARENA_SIZE
+#undef MODEL_SECTION
+} /* namespace kws */
+
+/* BERT-Tiny headers only declare the symbols of its C sources */
+#if defined(BENCHMARK_BERT_TINY)
+#include "ethosu/models/bert_tiny/u85/input.h"
+#include "ethosu/models/bert_tiny/u85/output.h"
+#include "ethosu/models/bert_tiny/u85/model_u85_256.h"
+
+namespace bert
+{
+constexpr size_t arenaSize = TENSOR_ARENA_SIZE;
+} /* namespace bert */
+#undef TENSOR_ARENA_SIZE
+#endif
+
+namespace
+{
+constexpr size_t maxArenaSize(size_t a, size_t b)
+{
+	return a > b ? a : b;
+}
+
+const BenchmarkModel models[] = {
+	{
+		kws::modelName,
+		kws::npuConfig,
+		DataPtr((void *)kws::networkModelData, sizeof(kws::networkModelData)),
+		DataPtr((void *)kws::inputData, sizeof(kws::inputData)),
+		DataPtr((void *)kws::expectedOutputData, sizeof(kws::expectedOutputData)),
+		0,
+		kws::arenaSize,
+		ModelPlacement::SramIfFits,
+	},
+#if defined(BENCHMARK_BERT_TINY)
+	{
+		modelName,
+		"ethos-u85-256",
+		DataPtr((void *)networkModelData, networkModelDataSize),
+		DataPtr((void *)inputData, inputDataSize),
+		DataPtr((void *)expectedOutputData, expectedOutputDataSize),
+		/* Same tolerance as the tflm_transformer sample */
+		3,
+		bert::arenaSize,
+		/* About 870KB, read in place unless the pool is enlarged */
+		ModelPlacement::SramIfFits,
+	},
+#endif
+};
+
+#if defined(BENCHMARK_BERT_TINY)
+constexpr size_t arenaSize = maxArenaSize(kws::arenaSize, bert::arenaSize);
+#else
+constexpr size_t arenaSize = kws::arenaSize;
+#endif
+
+} /* namespace */
+
+__attribute__((section(".bss.tflm_arena"), aligned(16))) uint8_t benchmarkArena[arenaSize];
+const size_t benchmarkArenaSize = arenaSize;
+
+__attribute__((section(".bss.model_pool"), aligned(16)))
+uint8_t benchmarkModelPool[CONFIG_BENCHMARK_MODEL_POOL_SIZE];
+
+size_t getBenchmarkModels(const BenchmarkModel **_models)
+{
+	*_models = models;
+
+	return ARRAY_SIZE(models);
+}
@@ -0,0 +1,40 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include "inference_process.hpp"
+#include "model_placement.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct BenchmarkModel {
+	const char *name;
+	/* Vela accelerator configuration the model was compiled for */
+	const char *npuConfig;
+	InferenceProcess::DataPtr networkModel;
+	InferenceProcess::DataPtr input;
+	InferenceProcess::DataPtr expectedOutput;
+	int expectedOutputTolerance;
+	/* Arena size recommended by the model header */
+	size_t arenaSize;
+	/* Where the model is read from during the benchmark */
+	InferenceProcess::ModelPlacement placement;
+};
+
+/* Models of include/ethosu/models applicable to the configured NPU */
+size_t getBenchmarkModels(const BenchmarkModel **models);
+
+/* Arena shared by all models, sized for the largest one */
+extern uint8_t benchmarkArena[];
+extern const size_t benchmarkArenaSize;
+
+/* SRAM pool for models placed in SRAM, CONFIG_BENCHMARK_MODEL_POOL_SIZE bytes */
+extern uint8_t benchmarkModelPool[];
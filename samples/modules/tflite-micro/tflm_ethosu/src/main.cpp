@@ -9,6 +9,7 @@
  ****************************************************************************/
 
 #include "inference_process.hpp"
+#include "inference_service.hpp"
 
 #include <inttypes.h>
 #include <string>
@@ -40,13 +41,8 @@ using namespace InferenceProcess;
  * Defines
  ****************************************************************************/
 
-/* Number of worker threads running the inferences. There should typically be
- * one worker thread per NPU. */
-#ifndef NUM_INFERENCE_TASKS
-#define NUM_INFERENCE_TASKS 1
-#endif
-
-/* Number of sender tasks, that post inference requests to the worker threads. */
+/* Number of sender tasks, that submit inference requests to the NPU service.
+ * Sender n submits with priority n, so sender 0 overtakes the others. */
 #ifndef NUM_JOB_TASKS
 #define NUM_JOB_TASKS 2
 #endif
@@ -56,6 +52,11 @@ using namespace InferenceProcess;
 #define NUM_JOBS_PER_TASK 2
 #endif
 
+/* Stack size of the NPU service thread, the only thread running TFLM */
+#ifndef INFERENCE_SERVICE_STACK_SIZE
+#define INFERENCE_SERVICE_STACK_SIZE 8192
+#endif
+
 /* Tensor arena size - use the model's tensorArenaSize variable */
 /* Note: tensorArenaSize is defined in the model header file */
 
@@ -65,155 +66,85 @@ using namespace InferenceProcess;
 
 namespace
 {
-struct InferenceProcessParams {
-	InferenceProcessParams() : tensorArena(nullptr), arenaSize(0)
-	{
-	}
-
-	InferenceProcessParams(k_queue *_queue, uint8_t *_tensorArena, size_t _arenaSize)
-		: queueHandle(_queue), tensorArena(_tensorArena), arenaSize(_arenaSize)
-	{
-	}
-
-	k_queue *queueHandle;
-	uint8_t *tensorArena;
-	size_t arenaSize;
-};
-
-/* Wrapper around InferenceProcess::InferenceJob. Adds responseQueue and status
- * for Zephyr multi-tasking purposes.& */
-struct xInferenceJob : public InferenceJob {
-	xInferenceJob() : InferenceJob(), responseQueue(nullptr), status(false)
-	{
-	}
-
-	xInferenceJob(const string &_name, const DataPtr &_networkModel,
-		      const vector<DataPtr> &_input, const vector<DataPtr> &_output,
-		      const vector<DataPtr> &_expectedOutput, k_queue *_queue)
-		: InferenceJob(_name, _networkModel, _input, _output, _expectedOutput),
-		  responseQueue(_queue), status(false)
-	{
-	}
-
-	k_queue *responseQueue;
-	bool status;
+struct InferenceSenderParams {
+	InferenceService *service;
+	int priority;
 };
 
 /* Number of total completed jobs, needed to exit application correctly if
  * NUM_JOB_TASKS > 1 */
-volatile int totalCompletedJobs = 0;
+atomic_t totalCompletedJobs = ATOMIC_INIT(0);
 
 /* TensorArena allocation using TENSOR_ARENA_SIZE from model header
  * Note: TENSOR_ARENA_SIZE macro is defined in model headers (e.g., model_u85_256.h)
  * For keyword_spotting: U55 uses ~50KB, U85 uses ~50KB
  */
 __attribute__((section(".bss.tflm_arena"), aligned(16)))
-uint8_t inferenceProcessTensorArena[NUM_INFERENCE_TASKS][TENSOR_ARENA_SIZE];
+uint8_t inferenceProcessTensorArena[TENSOR_ARENA_SIZE];
 
-/* Allocate and initialize heap */
-void *allocateHeap(const size_t size)
-{
-	k_heap *heap = static_cast<k_heap *>(k_malloc(sizeof(k_heap)));
-	uint8_t *buf = static_cast<uint8_t *>(k_malloc(size));
-
-	if ((buf == nullptr) || (heap == nullptr)) {
-		printk("Heap allocation failed. heap=%p, buf=%p, size=%zu\n", heap, buf, size);
-		exit(1);
-	}
-
-	k_heap_init(heap, buf, size);
+K_THREAD_STACK_DEFINE(inferenceServiceStack, INFERENCE_SERVICE_STACK_SIZE);
 
-	return static_cast<void *>(heap);
-}
-
-/* inferenceProcessTask - Run jobs from queue with available driver */
-void inferenceProcessTask(void *_name, void *heap, void *_params)
+/* inferenceSenderTask - Creates NUM_JOBS_PER_TASK jobs, submits them to the
+ * NPU service without blocking, and then polls for their completion */
+void inferenceSenderTask(void *_name, void *_params, void *)
 {
 	string *name = static_cast<string *>(_name);
-	InferenceProcessParams *params = static_cast<InferenceProcessParams *>(_params);
-
-	/* Assign the pre allocated heap - used in the k_queue_alloc_append */
-	k_thread_heap_assign(k_current_get(), static_cast<k_heap *>(heap));
-
-	class InferenceProcess inferenceProcess(params->tensorArena, params->arenaSize);
+	InferenceSenderParams *params = static_cast<InferenceSenderParams *>(_params);
+	int ret = 0;
 
-	for (;;) {
-		/* Receive inference job */
-		xInferenceJob *job =
-			static_cast<xInferenceJob *>(k_queue_get(params->queueHandle, Z_FOREVER));
+	InferenceJob jobs[NUM_JOBS_PER_TASK];
+	InferenceRequest requests[NUM_JOBS_PER_TASK];
+	struct k_poll_signal signals[NUM_JOBS_PER_TASK];
+	struct k_poll_event events[NUM_JOBS_PER_TASK];
 
-		printk("%s: Received inference job. job=%p\n", name->c_str(), job);
+	/* Submit all jobs, the NPU service queues them by priority */
+	for (int n = 0; n < NUM_JOBS_PER_TASK; n++) {
+		auto &job = jobs[n];
+		job = InferenceJob(modelName,
+				   DataPtr((void *)networkModelData, sizeof(networkModelData)),
+				   { DataPtr((void *)inputData, sizeof(inputData)) }, {},
+				   { DataPtr((void *)expectedOutputData, sizeof(expectedOutputData)) });
 
-		/* Run inference */
-		job->status = inferenceProcess.runJob(*job);
+		k_poll_signal_init(&signals[n]);
+		k_poll_event_init(&events[n], K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+				  &signals[n]);
+		requests[n] = InferenceRequest(&job, params->priority, &signals[n]);
 
-		printk("%s: Sending inference response. job=%p\n", name->c_str(), job);
+		printk("%s: Submitting inference. job=%p, name=%s, priority=%d\n", name->c_str(),
+		       &job, job.name.c_str(), params->priority);
 
-		/* Return inference message */
-		int ret = k_queue_alloc_append(job->responseQueue, job);
-		if (0 != ret) {
-			printk("%s: Failed to send message\n", name->c_str());
+		if (params->service->submit(requests[n])) {
+			printk("%s: Failed to submit inference\n", name->c_str());
 			exit(1);
 		}
 	}
 
-	k_thread_abort(k_current_get());
+	/* Listen for completion status */
+	for (int done = 0; done < NUM_JOBS_PER_TASK;) {
+		k_poll(events, NUM_JOBS_PER_TASK, K_FOREVER);
 
-	CODE_UNREACHABLE;
-}
+		for (int n = 0; n < NUM_JOBS_PER_TASK; n++) {
+			if (events[n].state != K_POLL_STATE_SIGNALED) {
+				continue;
+			}
 
-/* inferenceSenderTask - Creates NUM_INFERENCE_JOBS jobs, queues them, and then
- * listens for completion status */
-void inferenceSenderTask(void *_name, void *heap, void *_queue)
-{
-	string *name = static_cast<string *>(_name);
-	k_queue *inferenceQueue = static_cast<k_queue *>(_queue);
-	int ret = 0;
+			/* Stop polling this request */
+			events[n].state = K_POLL_STATE_NOT_READY;
+			events[n].type = K_POLL_TYPE_IGNORE;
+			done++;
 
-	/* Assign the pre allocated heap - used in the k_queue_alloc_append */
-	k_thread_heap_assign(k_current_get(), static_cast<k_heap *>(heap));
+			printk("%s: Received job response. job=%p, status=%u\n", name->c_str(),
+			       &jobs[n], requests[n].status);
 
-	/* Create queue for response messages */
-	k_queue senderQueue;
-	k_queue_init(&senderQueue);
-
-	/* Loop over all jobs and push them to inference queue */
-	xInferenceJob jobs[NUM_JOBS_PER_TASK];
-	for (int n = 0; n < NUM_JOBS_PER_TASK; n++) {
-		auto &job = jobs[n];
-		job = xInferenceJob(modelName, DataPtr((void*)networkModelData, sizeof(networkModelData)),
-				    { DataPtr((void*)inputData, sizeof(inputData)) }, {},
-				    { DataPtr((void*)expectedOutputData, sizeof(expectedOutputData)) },
-				    &senderQueue);
-
-		printk("%s: Sending inference. job=%p, name=%s\n", name->c_str(), &job,
-		       job.name.c_str());
-
-		/* Queue job */
-		ret = k_queue_alloc_append(inferenceQueue, &job);
-		if (0 != ret) {
-			printk("%s: Failed to send message\n", name->c_str());
-			exit(1);
+			ret += requests[n].status;
 		}
 	}
 
-	/* Listen for completion status */
-	do {
-		xInferenceJob *job =
-			static_cast<xInferenceJob *>(k_queue_get(&senderQueue, Z_FOREVER));
-
-		printk("%s: Received job response. job=%p, status=%u\n", name->c_str(), job,
-		       job->status);
-
-		totalCompletedJobs++;
-
-		ret += job->status;
-		if (job->status != 0) {
-			break;
-		}
-	} while (totalCompletedJobs < NUM_JOBS_PER_TASK * NUM_JOB_TASKS);
-
-	exit(ret);
+	if (atomic_add(&totalCompletedJobs, NUM_JOBS_PER_TASK) + NUM_JOBS_PER_TASK ==
+		    NUM_JOBS_PER_TASK * NUM_JOB_TASKS ||
+	    ret != 0) {
+		exit(ret);
+	}
 }
 
 } /* namespace */
@@ -224,16 +155,13 @@ int main()
 	struct {
 		k_thread thread;
 		k_tid_t id;
-	} threads[NUM_JOB_TASKS + NUM_INFERENCE_TASKS];
-	size_t nthreads = 0;
-
-	/* Allocate one global heap for all threads */
-	void *heapPtr = allocateHeap(256);
+	} threads[NUM_JOB_TASKS];
+	InferenceSenderParams senderParams[NUM_JOB_TASKS];
 
-	k_queue inferenceQueue;
-	k_queue_init(&inferenceQueue);
+	/* Single thread owning the NPU, shared by all senders */
+	static InferenceService inferenceService(inferenceProcessTensorArena, tensorArenaSize);
 
-	/* inferenceSender tasks to create and queue the jobs */
+	/* inferenceSender tasks to create and submit the jobs */
 	for (int n = 0; n < NUM_JOB_TASKS; n++) {
 		const size_t stackSize = 2048;
 		k_thread_stack_t *stack = static_cast<k_thread_stack_t *>(k_malloc(stackSize));
@@ -242,47 +170,23 @@ int main()
 			exit(1);
 		}
 
-		auto &thread = threads[nthreads];
+		auto &thread = threads[n];
+		senderParams[n] = { &inferenceService, n };
 		string *name = new string("sender " + to_string(n));
 
 		thread.id = k_thread_create(&thread.thread, stack, stackSize, inferenceSenderTask,
-					    name, heapPtr, &inferenceQueue, 3, 0, K_FOREVER);
+					    name, &senderParams[n], NULL, 3, 0, K_FOREVER);
 		if (thread.id == 0) {
 			printk("Failed to create 'inferenceSenderTask%i'\n", n);
 			exit(1);
 		}
-
-		nthreads++;
 	}
 
-	/* Create inferenceProcess tasks to process the queued jobs */
-	InferenceProcessParams taskParams[NUM_INFERENCE_TASKS];
-	for (int n = 0; n < NUM_INFERENCE_TASKS; n++) {
-		const size_t stackSize = 8192;
-		k_thread_stack_t *stack = static_cast<k_thread_stack_t *>(k_malloc(stackSize));
-		if (stack == nullptr) {
-			printk("Failed to allocate stack to 'inferenceSenderTask%i'\n", n);
-			exit(1);
-		}
-
-		auto &thread = threads[nthreads];
-		auto &taskParam = taskParams[n];
-		taskParam = InferenceProcessParams(&inferenceQueue, inferenceProcessTensorArena[n],
-						   tensorArenaSize);
-		string *name = new string("runner " + to_string(n));
-
-		thread.id = k_thread_create(&thread.thread, stack, stackSize, inferenceProcessTask,
-					    name, heapPtr, &taskParam, 2, 0, K_FOREVER);
-		if (thread.id == 0) {
-			printk("Failed to create 'inferenceProcessTask%i'\n", n);
-			exit(1);
-		}
-
-		nthreads++;
-	}
+	inferenceService.start(inferenceServiceStack,
+			       K_THREAD_STACK_SIZEOF(inferenceServiceStack), 2);
 
 	/* start Scheduler */
-	for (size_t n = 0; n < nthreads; n++) {
+	for (size_t n = 0; n < NUM_JOB_TASKS; n++) {
 		k_thread_start(threads[n].id);
 	}
 
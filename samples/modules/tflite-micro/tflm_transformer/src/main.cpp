@@ -174,6 +174,8 @@ void inferenceSenderTask(void *_name, void *heap, void *_queue)
 				    {},
 				    { DataPtr((void*)expectedOutputData, expectedOutputDataSize) },
 				    &senderQueue);
+		/* NPU and reference rounding differ slightly in the attention layers */
+		job.expectedOutputTolerance = 3;
 
 		printk("%s: Sending inference. job=%p, name=%s\n", name->c_str(), &job,
 		       job.name.c_str());
@@ -0,0 +1,253 @@
+# Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+# Use, distribution and modification of this code is permitted under the
+# terms stated in the Alif Semiconductor Software License Agreement
+#
+# You should have received a copy of the Alif Semiconductor Software
+# License Agreement with this file. If not, please write to:
+# contact@alifsemi.com, or visit: https://alifsemi.com/license
+
+"""Encode an image into a compressed C asset for subsys/img_assets.
+
+The pixels are stored once, as ARGB8888, with the QOI operations
+(https://qoiformat.org/qoi-specification.pdf) but without the QOI header and
+end marker. The encoder state is reset every band of rows, so a band can be
+decoded without the ones before it: the C file lists the offset of every band.
+The on-target decoder converts to the other pixel formats while decoding.
+"""
+
+import argparse
+import os
+import sys
+
+QOI_OP_INDEX = 0x00
+QOI_OP_DIFF = 0x40
+QOI_OP_LUMA = 0x80
+QOI_OP_RUN = 0xC0
+QOI_OP_RGB = 0xFE
+QOI_OP_RGBA = 0xFF
+
+HEADER = '''/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file {file}
+ *
+ * Generated by scripts/img_assets/encode_img_asset.py, do not edit.
+ */
+
+#define ASSET_INTERNAL
+
+#include "assets.h"
+
+'''
+
+
+def qoi_hash(r, g, b, a):
+    return (r * 3 + g * 5 + b * 7 + a * 11) % 64
+
+
+def encode_band(pixels):
+    """Encode (r, g, b, a) tuples starting from the QOI initial state."""
+    out = bytearray()
+    index = [(0, 0, 0, 0)] * 64
+    prev = (0, 0, 0, 255)
+    run = 0
+
+    for px in pixels:
+        if px == prev:
+            run += 1
+            if run == 62:
+                out.append(QOI_OP_RUN | (run - 1))
+                run = 0
+            continue
+
+        if run:
+            out.append(QOI_OP_RUN | (run - 1))
+            run = 0
+
+        h = qoi_hash(*px)
+        if index[h] == px:
+            out.append(QOI_OP_INDEX | h)
+        else:
+            index[h] = px
+            r, g, b, a = px
+            if a == prev[3]:
+                dr = (r - prev[0] + 128) % 256 - 128
+                dg = (g - prev[1] + 128) % 256 - 128
+                db = (b - prev[2] + 128) % 256 - 128
+                dr_dg = dr - dg
+                db_dg = db - dg
+                if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                    out.append(QOI_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+                elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                    out.append(QOI_OP_LUMA | (dg + 32))
+                    out.append((dr_dg + 8) << 4 | (db_dg + 8))
+                else:
+                    out += bytes((QOI_OP_RGB, r, g, b))
+            else:
+                out += bytes((QOI_OP_RGBA, r, g, b, a))
+        prev = px
+
+    if run:
+        out.append(QOI_OP_RUN | (run - 1))
+
+    return out
+
+
+def decode_band(data, count):
+    """Reference decoder, used to check the encoder output."""
+    pixels = []
+    index = [(0, 0, 0, 0)] * 64
+    px = (0, 0, 0, 255)
+    pos = 0
+
+    while len(pixels) < count:
+        b1 = data[pos]
+        pos += 1
+        if b1 == QOI_OP_RGB:
+            px = (data[pos], data[pos + 1], data[pos + 2], px[3])
+            pos += 3
+        elif b1 == QOI_OP_RGBA:
+            px = tuple(data[pos:pos + 4])
+            pos += 4
+        elif b1 & 0xC0 == QOI_OP_INDEX:
+            px = index[b1]
+        elif b1 & 0xC0 == QOI_OP_DIFF:
+            px = ((px[0] + (b1 >> 4 & 3) - 2) % 256, (px[1] + (b1 >> 2 & 3) - 2) % 256,
+                  (px[2] + (b1 & 3) - 2) % 256, px[3])
+        elif b1 & 0xC0 == QOI_OP_LUMA:
+            b2 = data[pos]
+            pos += 1
+            dg = (b1 & 0x3F) - 32
+            px = ((px[0] + dg - 8 + (b2 >> 4)) % 256, (px[1] + dg) % 256,
+                  (px[2] + dg - 8 + (b2 & 0xF)) % 256, px[3])
+        else:
+            pixels += [px] * ((b1 & 0x3F) + 1)
+            continue
+        index[qoi_hash(*px)] = px
+        pixels.append(px)
+
+    if len(pixels) != count or pos != len(data):
+        raise ValueError('band does not decode to its pixels')
+
+    return pixels
+
+
+def read_raw(path, width, height, fmt):
+    data = open(path, 'rb').read()
+    bpp = 3 if fmt in ('rgb888', 'bgr888') else 4
+    if len(data) != width * height * bpp:
+        sys.exit(f'{path}: {len(data)} bytes, expected {width * height * bpp}')
+
+    pixels = []
+    for i in range(0, len(data), bpp):
+        p = data[i:i + bpp]
+        # Byte order in memory of the little endian AIPL formats
+        if fmt == 'argb8888':
+            pixels.append((p[2], p[1], p[0], p[3]))
+        elif fmt == 'rgba8888':
+            pixels.append((p[3], p[2], p[1], p[0]))
+        elif fmt == 'rgb888':
+            pixels.append((p[2], p[1], p[0], 255))
+        else:
+            pixels.append((p[0], p[1], p[2], 255))
+
+    return pixels
+
+
+def read_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit('Pillow is needed to read image files, or pass --raw')
+
+    img = Image.open(path).convert('RGBA')
+    return img.width, img.height, list(img.getdata())
+
+
+def write_c(path, name, width, height, band_height, data, offsets):
+    lines = [HEADER.format(file=os.path.basename(path))]
+
+    lines.append(f'static const ASSET_PREFIX uint8_t {name}_DATA[] = {{\n')
+    for i in range(0, len(data), 15):
+        chunk = ', '.join(f'0x{b:02x}' for b in data[i:i + 15])
+        end = '};\n' if i + 15 >= len(data) else '\n'
+        lines.append(f'\t{chunk},{end}' if end == '\n' else f'\t{chunk}{end}')
+    lines.append('\n')
+
+    lines.append(f'static const uint32_t {name}_BANDS[] = {{\n')
+    for i in range(0, len(offsets), 8):
+        chunk = ', '.join(str(o) for o in offsets[i:i + 8])
+        last = i + 8 >= len(offsets)
+        lines.append(f'\t{chunk}' + ('};\n' if last else ',\n'))
+    lines.append('\n')
+
+    prefix = f'const compressed_image_t {name} = {{'
+    fields = [f'.data = {name}_DATA', f'.data_size = sizeof({name}_DATA)', f'.width = {width}',
+              f'.height = {height}', f'.band_height = {band_height}',
+              f'.band_offsets = {name}_BANDS']
+    indent = '\t' * (len(prefix) // 8) + ' ' * (len(prefix) % 8)
+    lines.append(prefix + (',\n' + indent).join(fields) + '};\n')
+
+    with open(path, 'w') as f:
+        f.write(''.join(lines))
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Encode an image into a compressed C asset',
+                                     epilog='''Without --raw the input is read with Pillow.
+                                     Raw input is a headerless dump of pixels in the memory
+                                     layout of the given AIPL format, e.g. an image_t data
+                                     array.''')
+    parser.add_argument('input', help='Image file, or raw pixels with --raw')
+    parser.add_argument('output', help='C file to write')
+    parser.add_argument('--name', required=True, help='Name of the compressed_image_t')
+    parser.add_argument('--raw', choices=['argb8888', 'rgba8888', 'rgb888', 'bgr888'],
+                        help='Input is raw pixels in this format')
+    parser.add_argument('--width', type=int, help='Width of raw input')
+    parser.add_argument('--height', type=int, help='Height of raw input')
+    parser.add_argument('--band-height', type=int, default=16,
+                        help='Rows per independently decodable band (default: %(default)s)')
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+
+    if args.raw:
+        if not args.width or not args.height:
+            sys.exit('--raw needs --width and --height')
+        width, height = args.width, args.height
+        pixels = read_raw(args.input, width, height, args.raw)
+    else:
+        width, height, pixels = read_image(args.input)
+
+    if args.band_height < 1:
+        sys.exit('--band-height must be at least 1')
+
+    data = bytearray()
+    offsets = []
+    for row in range(0, height, args.band_height):
+        band = pixels[row * width:min(row + args.band_height, height) * width]
+        encoded = encode_band(band)
+        if decode_band(encoded, len(band)) != band:
+            sys.exit(f'band at row {row} does not round trip')
+        offsets.append(len(data))
+        data += encoded
+
+    write_c(args.output, args.name, width, height, args.band_height, data, offsets)
+
+    print(f'{args.name}: {width}x{height}, {len(data)} bytes, '
+          f'{100 * len(data) / (width * height * 4):.1f}% of ARGB8888, {len(offsets)} bands')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,133 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include <zephyr/sys/util.h>
+#include "damage.h"
+
+static uint32_t rect_area(const struct damage_rect *rect)
+{
+	return (uint32_t)rect->width * rect->height;
+}
+
+static struct damage_rect rect_union(const struct damage_rect *a, const struct damage_rect *b)
+{
+	uint16_t x0 = MIN(a->x, b->x);
+	uint16_t y0 = MIN(a->y, b->y);
+	uint16_t x1 = MAX(a->x + a->width, b->x + b->width);
+	uint16_t y1 = MAX(a->y + a->height, b->y + b->height);
+	struct damage_rect rect = {x0, y0, x1 - x0, y1 - y0};
+
+	return rect;
+}
+
+/* Pixels written in excess when writing the bounding box of a and b instead of both, negative
+ * when they overlap enough for the bounding box to be cheaper
+ */
+static int32_t union_cost(const struct damage_rect *a, const struct damage_rect *b)
+{
+	struct damage_rect rect = rect_union(a, b);
+
+	return (int32_t)rect_area(&rect) - (int32_t)(rect_area(a) + rect_area(b));
+}
+
+static void remove_rect(struct damage *damage, uint8_t index)
+{
+	damage->rects[index] = damage->rects[--damage->count];
+}
+
+static void add_rect(struct damage *damage, struct damage_rect rect)
+{
+	/* Absorb the rectangles the new one covers or can be merged with for free, as long as
+	 * the grown rectangle keeps absorbing others
+	 */
+	bool merged = true;
+
+	while (merged) {
+		merged = false;
+
+		for (uint8_t i = 0; i < damage->count; ++i) {
+			if (union_cost(&damage->rects[i], &rect) <= 0) {
+				rect = rect_union(&damage->rects[i], &rect);
+				remove_rect(damage, i);
+				merged = true;
+				break;
+			}
+		}
+	}
+
+	if (damage->count < DAMAGE_MAX_RECTS) {
+		damage->rects[damage->count++] = rect;
+		return;
+	}
+
+	/* Full: merge with the rectangle growing the least */
+	uint8_t best = 0;
+	int32_t best_cost = INT32_MAX;
+
+	for (uint8_t i = 0; i < damage->count; ++i) {
+		int32_t cost = union_cost(&damage->rects[i], &rect);
+
+		if (cost < best_cost) {
+			best = i;
+			best_cost = cost;
+		}
+	}
+
+	rect = rect_union(&damage->rects[best], &rect);
+	remove_rect(damage, best);
+	add_rect(damage, rect);
+}
+
+void damage_reset(struct damage *damage)
+{
+	damage->count = 0;
+}
+
+void damage_add(struct damage *damage, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		uint16_t screen_width, uint16_t screen_height)
+{
+	if (x >= screen_width || y >= screen_height || width == 0 || height == 0) {
+		return;
+	}
+
+	struct damage_rect rect = {x, y, MIN(width, screen_width - x),
+				   MIN(height, screen_height - y)};
+
+	add_rect(damage, rect);
+}
+
+void damage_merge(struct damage *damage, const struct damage *src)
+{
+	/* Either one is a whole frame */
+	if (damage->count == 0 || src->count == 0) {
+		damage->count = 0;
+		return;
+	}
+
+	for (uint8_t i = 0; i < src->count; ++i) {
+		add_rect(damage, src->rects[i]);
+	}
+}
+
+bool damage_is_partial(const struct damage *damage, uint16_t screen_width, uint16_t screen_height,
+		       uint32_t full_update_percent)
+{
+	if (damage->count == 0) {
+		return false;
+	}
+
+	uint32_t area = 0;
+
+	for (uint8_t i = 0; i < damage->count; ++i) {
+		area += rect_area(&damage->rects[i]);
+	}
+
+	return area * 100 < (uint32_t)screen_width * screen_height * full_update_percent;
+}
@@ -0,0 +1,52 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ *   damage.h
+ *
+ *   Dirty rectangles of a frame, kept as a small set: rectangles inside others are dropped,
+ *   overlapping ones merged when their bounding box costs no more pixels than writing both,
+ *   and once the set is full the two whose bounding box grows the least are merged.
+ *   An empty set means the whole frame.
+ */
+#ifndef __DAMAGE_H
+#define __DAMAGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DAMAGE_MAX_RECTS CONFIG_DBUF_DISPLAY_DIRTY_RECTS
+
+struct damage_rect {
+	uint16_t x;
+	uint16_t y;
+	uint16_t width;
+	uint16_t height;
+};
+
+struct damage {
+	struct damage_rect rects[DAMAGE_MAX_RECTS];
+	uint8_t count;
+};
+
+void damage_reset(struct damage *damage);
+
+/* Add a rectangle, clipped to the screen */
+void damage_add(struct damage *damage, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		uint16_t screen_width, uint16_t screen_height);
+
+/* Add the rectangles of src, for frames that were never shown */
+void damage_merge(struct damage *damage, const struct damage *src);
+
+/* Whether writing the rectangles is worth it, false for a whole frame update */
+bool damage_is_partial(const struct damage *damage, uint16_t screen_width, uint16_t screen_height,
+		       uint32_t full_update_percent);
+
+#endif /* __DAMAGE_H */
@@ -10,10 +10,19 @@
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/display.h>
+#ifdef CONFIG_DBUF_DISPLAY_CDC200
 #include <zephyr/drivers/display/cdc200.h>
 #include <zephyr/drivers/mipi_dsi/dsi_dw.h>
+#endif
 #include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
 #include "display.h"
+#ifdef CONFIG_DBUF_DISPLAY_PARTIAL_UPDATES
+#include "damage.h"
+#endif
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+#include "frame_queue.h"
+#endif
 
 LOG_MODULE_REGISTER(display_app, LOG_LEVEL_DBG);
 
@@ -32,21 +41,41 @@ LOG_MODULE_REGISTER(display_app, LOG_LEVEL_DBG);
 
 uint8_t DBUF_DISPLAY_ATTRS buf0[BUFFER_SIZE];
 uint8_t DBUF_DISPLAY_ATTRS buf1[BUFFER_SIZE];
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+uint8_t DBUF_DISPLAY_ATTRS buf2[BUFFER_SIZE];
+#endif
 
 enum {
 	BUFFER_1 = 0,
 	BUFFER_2 = 1,
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+	BUFFER_3 = 2,
+#endif
 	NUM_BUFFERS
 };
 
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+static uint8_t *buffers[NUM_BUFFERS] = {buf0, buf1, buf2};
+#else
 static uint8_t *buffers[NUM_BUFFERS] = {buf0, buf1};
+#endif
 
-static uint8_t current_buffer = BUFFER_1;
-static uint32_t frame_durations[NUM_BUFFERS] = {1, 1};
-static uint32_t switch_times[NUM_BUFFERS] = {0, 0};
+static struct display_stats stats;
+static struct k_spinlock stats_lock;
+
+#ifdef CONFIG_DBUF_DISPLAY_PARTIAL_UPDATES
+/* Dirty rectangles of the frame in each buffer, from the time it is rendered to until it is
+ * written to the display
+ */
+static struct damage frame_damage[NUM_BUFFERS];
+#endif
 
 static const struct device *display_dev = DEVICE_DT_GET(DISPLAY_NODE);
 
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+static void start_flip_thread(void);
+#endif
+
 /* Main Display Initialization Function */
 int display_init(void)
 {
@@ -55,6 +84,7 @@ int display_init(void)
 		return -ENODEV;
 	}
 
+#ifdef CONFIG_DBUF_DISPLAY_CDC200
 	const struct device *panel = DEVICE_DT_GET(DT_ALIAS(panel));
 	const struct device *dsi = DEVICE_DT_GET(DT_ALIAS(mipi_dsi));
 	int ret;
@@ -77,10 +107,287 @@ int display_init(void)
 	}
 
 	cdc200_set_enable(display_dev, true);
+#else
+	display_blanking_off(display_dev);
+#endif
+
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+	start_flip_thread();
+#endif
 
 	return 0;
 }
 
+static void count_frame(bool late, bool partial)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	++stats.frames;
+	stats.late += late;
+	stats.partial += partial;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+/* Write the buffer to the display, only its dirty rectangles if worth it */
+static bool show_buffer(uint8_t index)
+{
+#ifdef CONFIG_DBUF_DISPLAY_PARTIAL_UPDATES
+	const struct damage *damage = &frame_damage[index];
+
+	if (damage_is_partial(damage, DISPLAY_WIDTH, DISPLAY_HEIGHT,
+			      CONFIG_DBUF_DISPLAY_FULL_UPDATE_PERCENT)) {
+		for (uint8_t i = 0; i < damage->count; ++i) {
+			const struct damage_rect *rect = &damage->rects[i];
+			uint32_t offset = (rect->y * DISPLAY_WIDTH + rect->x) * 2;
+			struct display_buffer_descriptor desc = {
+				.buf_size = ((rect->height - 1) * DISPLAY_WIDTH + rect->width) * 2,
+				.width = rect->width,
+				.height = rect->height,
+				.pitch = DISPLAY_WIDTH};
+
+			display_write(display_dev, rect->x, rect->y, &desc,
+				      buffers[index] + offset);
+		}
+
+		return true;
+	}
+#endif
+
+	struct display_buffer_descriptor desc = {.buf_size = BUFFER_SIZE,
+						 .width = DISPLAY_WIDTH,
+						 .height = DISPLAY_HEIGHT,
+						 .pitch = DISPLAY_WIDTH};
+
+	display_write(display_dev, 0, 0, &desc, buffers[index]);
+
+	return false;
+}
+
+static int buffer_index(const void *buffer)
+{
+	for (int i = 0; i < NUM_BUFFERS; ++i) {
+		if (buffers[i] == buffer) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/* The buffer is about to be rendered to, none of its previous changes are pending */
+static void reset_damage(uint8_t index)
+{
+#ifdef CONFIG_DBUF_DISPLAY_PARTIAL_UPDATES
+	damage_reset(&frame_damage[index]);
+#else
+	ARG_UNUSED(index);
+#endif
+}
+
+void display_add_dirty_rect(void *buffer, uint16_t x, uint16_t y, uint16_t width,
+			    uint16_t height)
+{
+	int index = buffer_index(buffer);
+
+	if (index < 0) {
+		return;
+	}
+
+#ifdef CONFIG_DBUF_DISPLAY_PARTIAL_UPDATES
+	/* Only the renderer uses the damage of a buffer being rendered to, no lock needed */
+	damage_add(&frame_damage[index], x, y, width, height, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+#else
+	ARG_UNUSED(x);
+	ARG_UNUSED(y);
+	ARG_UNUSED(width);
+	ARG_UNUSED(height);
+#endif
+}
+
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+
+BUILD_ASSERT(NUM_BUFFERS == FRAME_QUEUE_BUFFERS, "frame_queue.h is for triple buffering");
+
+/* Buffer states, and the free buffers to wait for */
+static struct frame_queue frame_queue;
+/* Back buffer of display_inactive_buffer() and display_next_frame() */
+static void *legacy_back_buffer;
+
+static struct k_spinlock buffers_lock;
+
+K_SEM_DEFINE(free_buffers_sem, NUM_BUFFERS - 1, NUM_BUFFERS - 1);
+K_SEM_DEFINE(vsync_sem, 0, 1);
+
+K_THREAD_STACK_DEFINE(flip_stack, CONFIG_DBUF_DISPLAY_FLIP_THREAD_STACK_SIZE);
+static struct k_thread flip_thread;
+
+void display_vsync(void)
+{
+	k_sem_give(&vsync_sem);
+}
+
+#ifndef CONFIG_DBUF_DISPLAY_VSYNC_EXTERNAL
+static void vsync_timer_expiry(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	display_vsync();
+}
+
+K_TIMER_DEFINE(vsync_timer, vsync_timer_expiry, NULL);
+#endif
+
+/* At each vsync, free the buffer replaced at the previous one and show the next due frame,
+ * see frame_queue.h
+ */
+static void flip_thread_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		k_sem_take(&vsync_sem, K_FOREVER);
+
+		struct frame_flip flip;
+		k_spinlock_key_t key = k_spin_lock(&buffers_lock);
+
+		frame_queue_vsync(&frame_queue, k_uptime_get_32(), &flip);
+
+#ifdef CONFIG_DBUF_DISPLAY_PARTIAL_UPDATES
+		/* Never shown, their changes have to be written with the next one */
+		for (uint8_t i = 0; i < flip.num_dropped; ++i) {
+			uint8_t next = i + 1 < flip.num_dropped ? flip.dropped[i + 1] : flip.shown;
+
+			damage_merge(&frame_damage[next], &frame_damage[flip.dropped[i]]);
+		}
+#endif
+
+		k_spin_unlock(&buffers_lock, key);
+
+		for (uint8_t i = 0; i < flip.num_freed; ++i) {
+			k_sem_give(&free_buffers_sem);
+		}
+
+		if (flip.shown == FRAME_QUEUE_NONE) {
+			continue;
+		}
+
+		key = k_spin_lock(&stats_lock);
+		stats.dropped += flip.num_dropped;
+		k_spin_unlock(&stats_lock, key);
+
+		count_frame(flip.late, show_buffer(flip.shown));
+	}
+}
+
+static void start_flip_thread(void)
+{
+	frame_queue_init(&frame_queue);
+
+	k_thread_create(&flip_thread, flip_stack, K_THREAD_STACK_SIZEOF(flip_stack),
+			flip_thread_entry, NULL, NULL, NULL,
+			CONFIG_DBUF_DISPLAY_FLIP_THREAD_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&flip_thread, "display_flip");
+
+#ifndef CONFIG_DBUF_DISPLAY_VSYNC_EXTERNAL
+	k_timer_start(&vsync_timer, K_USEC(CONFIG_DBUF_DISPLAY_VSYNC_PERIOD_US),
+		      K_USEC(CONFIG_DBUF_DISPLAY_VSYNC_PERIOD_US));
+#endif
+}
+
+void *display_acquire_back_buffer(k_timeout_t timeout)
+{
+	if (k_sem_take(&free_buffers_sem, timeout) != 0) {
+		return NULL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&buffers_lock);
+	uint8_t index = frame_queue_acquire(&frame_queue);
+
+	if (index != FRAME_QUEUE_NONE) {
+		reset_damage(index);
+	}
+
+	k_spin_unlock(&buffers_lock, key);
+
+	return index != FRAME_QUEUE_NONE ? buffers[index] : NULL;
+}
+
+int display_submit_frame(void *buffer, uint32_t duration)
+{
+	int index = buffer_index(buffer);
+
+	if (index < 0) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&buffers_lock);
+	int ret = frame_queue_submit(&frame_queue, index, duration, k_uptime_get_32());
+
+	k_spin_unlock(&buffers_lock, key);
+
+	return ret;
+}
+
+void display_release_back_buffer(void *buffer)
+{
+	int index = buffer_index(buffer);
+
+	if (index < 0) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&buffers_lock);
+	bool released = frame_queue_release(&frame_queue, index);
+
+	k_spin_unlock(&buffers_lock, key);
+
+	if (released) {
+		k_sem_give(&free_buffers_sem);
+	}
+}
+
+void display_set_next_frame_duration(uint32_t duration)
+{
+	k_spinlock_key_t key = k_spin_lock(&buffers_lock);
+
+	frame_queue.durations[frame_queue.last_submitted] = duration;
+
+	k_spin_unlock(&buffers_lock, key);
+}
+
+void display_next_frame(void)
+{
+	void *buffer = display_inactive_buffer();
+
+	legacy_back_buffer = NULL;
+
+	/* Same duration as the previous frame until set again */
+	display_submit_frame(buffer, frame_queue.durations[frame_queue.last_submitted]);
+}
+
+void *display_active_buffer(void)
+{
+	return buffers[frame_queue.shown];
+}
+
+void *display_inactive_buffer(void)
+{
+	if (legacy_back_buffer == NULL) {
+		legacy_back_buffer = display_acquire_back_buffer(K_FOREVER);
+	}
+
+	return legacy_back_buffer;
+}
+
+#else /* CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER */
+
+static uint8_t current_buffer = BUFFER_1;
+static uint32_t frame_durations[NUM_BUFFERS] = {1, 1};
+static uint32_t switch_times[NUM_BUFFERS] = {0, 0};
+
 void display_set_next_frame_duration(uint32_t duration)
 {
 	frame_durations[current_buffer] = duration;
@@ -96,14 +403,13 @@ void display_next_frame(void)
 		k_sleep(K_MSEC(frame_durations[current_buffer] - current_frame_time));
 	}
 
-	current_buffer = (current_buffer + 1) % NUM_BUFFERS;
+	bool late = current_frame_time > frame_durations[current_buffer];
 
-	struct display_buffer_descriptor desc = {.buf_size = BUFFER_SIZE,
-						 .width = DISPLAY_WIDTH,
-						 .height = DISPLAY_HEIGHT,
-						 .pitch = DISPLAY_WIDTH};
+	current_buffer = (current_buffer + 1) % NUM_BUFFERS;
 
-	display_write(display_dev, 0, 0, &desc, buffers[current_buffer]);
+	count_frame(late, show_buffer(current_buffer));
+	/* Rendered to again for the frame after next */
+	reset_damage(current_buffer);
 
 	switch_times[current_buffer] = k_cycle_get_32();
 }
@@ -118,6 +424,26 @@ void *display_inactive_buffer(void)
 	return buffers[(current_buffer + 1) % NUM_BUFFERS];
 }
 
+#endif /* CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER */
+
+void display_get_stats(struct display_stats *out)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	*out = stats;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void display_reset_stats(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats = (struct display_stats){0};
+
+	k_spin_unlock(&stats_lock, key);
+}
+
 uint32_t display_width(void)
 {
 	return DISPLAY_WIDTH;
@@ -22,6 +22,19 @@
 #define DISPLAY_WIDTH  DT_PROP(DISPLAY_NODE, width)
 #define DISPLAY_HEIGHT DT_PROP(DISPLAY_NODE, height)
 
+struct display_stats {
+	/* Frames shown */
+	uint32_t frames;
+	/* Frames submitted after the previous one had been shown for its whole duration */
+	uint32_t late;
+	/* Triple buffering: queued frames skipped, their time on screen having passed while
+	 * a newer one was queued
+	 */
+	uint32_t dropped;
+	/* Frames written as dirty rectangles only */
+	uint32_t partial;
+};
+
 int display_init(void);
 void display_set_next_frame_duration(uint32_t duration);
 void display_next_frame(void);
@@ -30,4 +43,43 @@ void *display_inactive_buffer(void);
 uint32_t display_width(void);
 uint32_t display_height(void);
 
+/*
+ * Region of the frame being rendered in buffer, the back buffer or an acquired one, that
+ * changed since the previous frame. With CONFIG_DBUF_DISPLAY_PARTIAL_UPDATES only these regions
+ * are written to the display when the frame is shown, a frame without any is written whole.
+ * Does nothing otherwise.
+ */
+void display_add_dirty_rect(void *buffer, uint16_t x, uint16_t y, uint16_t width,
+			    uint16_t height);
+
+void display_get_stats(struct display_stats *stats);
+void display_reset_stats(void);
+
+#ifdef CONFIG_DBUF_DISPLAY_TRIPLE_BUFFER
+/*
+ * Buffers are acquired for rendering and submitted to the flip queue, the flip thread shows
+ * them in order at vsync, each one for at least its duration in milliseconds. With three
+ * buffers the renderer can be one frame ahead of the one waiting in the queue. A buffer
+ * replaced on screen is only free again at the next vsync, once the display controller has
+ * stopped scanning it out, see frame_queue.h.
+ *
+ * display_inactive_buffer() acquires a buffer for display_next_frame() to submit, with the
+ * duration given to display_set_next_frame_duration() afterwards.
+ */
+
+/* Free buffer to render to, NULL if none got free within timeout */
+void *display_acquire_back_buffer(k_timeout_t timeout);
+
+/* Queue an acquired buffer to be shown, -EINVAL if it is not acquired */
+int display_submit_frame(void *buffer, uint32_t duration);
+
+/* Give an acquired buffer back without showing it */
+void display_release_back_buffer(void *buffer);
+
+/* Vsync event, safe to call from an ISR. Called by a timer unless
+ * CONFIG_DBUF_DISPLAY_VSYNC_EXTERNAL is set.
+ */
+void display_vsync(void);
+#endif
+
 #endif /* __DISPLAY_ILI9806_H */
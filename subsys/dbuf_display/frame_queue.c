@@ -0,0 +1,116 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include "frame_queue.h"
+
+static uint8_t pop(struct frame_queue *queue)
+{
+	uint8_t index = queue->queue[0];
+
+	--queue->queued;
+	memmove(queue->queue, queue->queue + 1, queue->queued);
+
+	return index;
+}
+
+void frame_queue_init(struct frame_queue *queue)
+{
+	memset(queue, 0, sizeof(*queue));
+
+	for (uint8_t i = 0; i < FRAME_QUEUE_BUFFERS; ++i) {
+		queue->states[i] = FRAME_BUFFER_FREE;
+		queue->durations[i] = 1;
+	}
+
+	queue->states[0] = FRAME_BUFFER_SHOWN;
+	queue->shown = 0;
+	queue->retiring = FRAME_QUEUE_NONE;
+}
+
+uint8_t frame_queue_acquire(struct frame_queue *queue)
+{
+	for (uint8_t i = 0; i < FRAME_QUEUE_BUFFERS; ++i) {
+		if (queue->states[i] == FRAME_BUFFER_FREE) {
+			queue->states[i] = FRAME_BUFFER_ACQUIRED;
+			return i;
+		}
+	}
+
+	return FRAME_QUEUE_NONE;
+}
+
+int frame_queue_submit(struct frame_queue *queue, uint8_t index, uint32_t duration, uint32_t now)
+{
+	if (index >= FRAME_QUEUE_BUFFERS || queue->states[index] != FRAME_BUFFER_ACQUIRED) {
+		return -EINVAL;
+	}
+
+	queue->states[index] = FRAME_BUFFER_QUEUED;
+	queue->durations[index] = duration;
+	queue->submit_times[index] = now;
+	queue->last_submitted = index;
+	/* Never full, the shown buffer is not queued */
+	queue->queue[queue->queued++] = index;
+
+	return 0;
+}
+
+bool frame_queue_release(struct frame_queue *queue, uint8_t index)
+{
+	if (index >= FRAME_QUEUE_BUFFERS || queue->states[index] != FRAME_BUFFER_ACQUIRED) {
+		return false;
+	}
+
+	queue->states[index] = FRAME_BUFFER_FREE;
+
+	return true;
+}
+
+void frame_queue_vsync(struct frame_queue *queue, uint32_t now, struct frame_flip *flip)
+{
+	flip->shown = FRAME_QUEUE_NONE;
+	flip->num_dropped = 0;
+	flip->num_freed = 0;
+	flip->late = false;
+
+	/* Replaced at the previous flip, no longer scanned out */
+	if (queue->retiring != FRAME_QUEUE_NONE) {
+		queue->states[queue->retiring] = FRAME_BUFFER_FREE;
+		queue->retiring = FRAME_QUEUE_NONE;
+		++flip->num_freed;
+	}
+
+	uint32_t due = queue->shown_time + queue->durations[queue->shown];
+
+	if ((int32_t)(now - due) < 0 || queue->queued == 0) {
+		return;
+	}
+
+	uint8_t index = pop(queue);
+
+	while ((int32_t)(now - (due + queue->durations[index])) >= 0 && queue->queued != 0) {
+		due += queue->durations[index];
+		queue->states[index] = FRAME_BUFFER_FREE;
+		flip->dropped[flip->num_dropped++] = index;
+		++flip->num_freed;
+		index = pop(queue);
+	}
+
+	flip->late = (int32_t)(queue->submit_times[index] - due) > 0;
+	flip->shown = index;
+
+	queue->states[queue->shown] = FRAME_BUFFER_RETIRING;
+	queue->retiring = queue->shown;
+	queue->states[index] = FRAME_BUFFER_SHOWN;
+	queue->shown = index;
+	queue->shown_time = now;
+}
@@ -0,0 +1,81 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ *   frame_queue.h
+ *
+ *   Buffer states of triple buffering, without locking or kernel objects. Buffers are acquired
+ *   for rendering, submitted, and shown in submission order at vsync, each one for at least its
+ *   duration in milliseconds. A queued frame whose whole time on screen has passed is dropped
+ *   when a newer one is queued behind it. The buffer replaced on screen may still be scanned
+ *   out until the next vsync, it is retiring until then and only becomes free at that vsync.
+ */
+#ifndef __FRAME_QUEUE_H
+#define __FRAME_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FRAME_QUEUE_BUFFERS 3
+/* No buffer */
+#define FRAME_QUEUE_NONE    0xff
+
+enum frame_buffer_state {
+	FRAME_BUFFER_FREE,
+	/* Being rendered, from frame_queue_acquire() to frame_queue_submit() */
+	FRAME_BUFFER_ACQUIRED,
+	FRAME_BUFFER_QUEUED,
+	FRAME_BUFFER_SHOWN,
+	/* Replaced on screen, possibly still scanned out until the next vsync */
+	FRAME_BUFFER_RETIRING,
+};
+
+struct frame_queue {
+	uint8_t states[FRAME_QUEUE_BUFFERS];
+	uint32_t durations[FRAME_QUEUE_BUFFERS];
+	uint32_t submit_times[FRAME_QUEUE_BUFFERS];
+	/* Queued buffers, oldest first */
+	uint8_t queue[FRAME_QUEUE_BUFFERS];
+	uint8_t queued;
+	uint8_t shown;
+	uint32_t shown_time;
+	uint8_t retiring;
+	uint8_t last_submitted;
+};
+
+/* Outcome of a vsync */
+struct frame_flip {
+	/* Buffer to show now, FRAME_QUEUE_NONE to keep the shown one */
+	uint8_t shown;
+	/* Queued buffers skipped, oldest first, they are free */
+	uint8_t dropped[FRAME_QUEUE_BUFFERS];
+	uint8_t num_dropped;
+	/* Buffers that became free: the dropped ones, and the retiring one */
+	uint8_t num_freed;
+	/* The shown frame was submitted after the previous one had been shown for its duration */
+	bool late;
+};
+
+/* Buffer 0 shown, the others free */
+void frame_queue_init(struct frame_queue *queue);
+
+/* Acquire a free buffer, FRAME_QUEUE_NONE if there is none */
+uint8_t frame_queue_acquire(struct frame_queue *queue);
+
+/* Queue an acquired buffer, -EINVAL if it is not acquired */
+int frame_queue_submit(struct frame_queue *queue, uint8_t index, uint32_t duration, uint32_t now);
+
+/* Give an acquired buffer back, false if it is not acquired */
+bool frame_queue_release(struct frame_queue *queue, uint8_t index);
+
+/* Free the retiring buffer, and show the next due frame, see struct frame_flip */
+void frame_queue_vsync(struct frame_queue *queue, uint32_t now, struct frame_flip *flip);
+
+#endif /* __FRAME_QUEUE_H */
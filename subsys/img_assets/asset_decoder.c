@@ -0,0 +1,371 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file asset_decoder.c
+ */
+
+#include "asset_decoder.h"
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF  0x40
+#define QOI_OP_LUMA  0x80
+#define QOI_OP_RUN   0xc0
+#define QOI_OP_RGB   0xfe
+#define QOI_OP_RGBA  0xff
+#define QOI_OP_MASK  0xc0
+
+/* Pixels decoded to ARGB8888 on the stack before the conversion to the destination format */
+#define CHUNK_PIXELS 64
+
+typedef void (*store_fn_t)(const uint32_t *src, uint8_t *dst, uint32_t count);
+
+static inline uint32_t qoi_hash(uint32_t px)
+{
+	return ((px >> 16 & 0xff) * 3 + (px >> 8 & 0xff) * 5 + (px & 0xff) * 7 + (px >> 24) * 11) %
+	       64;
+}
+
+static inline uint32_t argb(uint32_t a, uint32_t r, uint32_t g, uint32_t b)
+{
+	return a << 24 | r << 16 | g << 8 | b;
+}
+
+static uint32_t num_bands(const compressed_image_t *image)
+{
+	return DIV_ROUND_UP(image->height, image->band_height);
+}
+
+static void start_band(asset_decoder_t *decoder, uint32_t band)
+{
+	const compressed_image_t *image = decoder->image;
+
+	decoder->pos = image->band_offsets[band];
+	decoder->end = band + 1 < num_bands(image) ? image->band_offsets[band + 1]
+						     : image->data_size;
+	decoder->run = 0;
+	decoder->px = argb(255, 0, 0, 0);
+	memset(decoder->index, 0, sizeof(decoder->index));
+}
+
+static int decode_pixels(asset_decoder_t *decoder, uint32_t *out, uint32_t count)
+{
+	const uint8_t *data = decoder->image->data;
+	uint32_t pos = decoder->pos;
+	uint32_t end = decoder->end;
+	uint32_t run = decoder->run;
+	uint32_t px = decoder->px;
+	uint32_t *index = decoder->index;
+
+	for (uint32_t i = 0; i < count; ++i) {
+		if (run > 0) {
+			--run;
+			out[i] = px;
+			continue;
+		}
+
+		if (pos >= end) {
+			return -EBADMSG;
+		}
+
+		uint32_t b1 = data[pos++];
+
+		if (b1 == QOI_OP_RGB) {
+			if (end - pos < 3) {
+				return -EBADMSG;
+			}
+			px = argb(px >> 24, data[pos], data[pos + 1], data[pos + 2]);
+			pos += 3;
+		} else if (b1 == QOI_OP_RGBA) {
+			if (end - pos < 4) {
+				return -EBADMSG;
+			}
+			px = argb(data[pos + 3], data[pos], data[pos + 1], data[pos + 2]);
+			pos += 4;
+		} else if ((b1 & QOI_OP_MASK) == QOI_OP_INDEX) {
+			px = index[b1];
+			out[i] = px;
+			continue;
+		} else if ((b1 & QOI_OP_MASK) == QOI_OP_DIFF) {
+			uint8_t r = (px >> 16) + (b1 >> 4 & 3) - 2;
+			uint8_t g = (px >> 8) + (b1 >> 2 & 3) - 2;
+			uint8_t b = px + (b1 & 3) - 2;
+
+			px = argb(px >> 24, r, g, b);
+		} else if ((b1 & QOI_OP_MASK) == QOI_OP_LUMA) {
+			if (pos >= end) {
+				return -EBADMSG;
+			}
+
+			uint32_t b2 = data[pos++];
+			int32_t dg = (int32_t)(b1 & 0x3f) - 32;
+			uint8_t r = (px >> 16) + dg - 8 + (b2 >> 4);
+			uint8_t g = (px >> 8) + dg;
+			uint8_t b = px + dg - 8 + (b2 & 0xf);
+
+			px = argb(px >> 24, r, g, b);
+		} else {
+			/* The pixel is repeated, the index already holds it */
+			run = b1 & 0x3f;
+			out[i] = px;
+			continue;
+		}
+
+		index[qoi_hash(px)] = px;
+		out[i] = px;
+	}
+
+	decoder->pos = pos;
+	decoder->run = run;
+	decoder->px = px;
+
+	return 0;
+}
+
+static void store_alpha8(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t px = src[i];
+
+		dst[i] = ((px >> 16 & 0xff) + (px >> 8 & 0xff) + (px & 0xff)) / 3;
+	}
+}
+
+static void store_argb8888(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		sys_put_le32(src[i], &dst[i * 4]);
+	}
+}
+
+static void store_rgba8888(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		sys_put_le32(src[i] << 8 | src[i] >> 24, &dst[i * 4]);
+	}
+}
+
+static void store_rgb888(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		sys_put_le24(src[i], &dst[i * 3]);
+	}
+}
+
+static void store_rgb565(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t px = src[i];
+
+		sys_put_le16((px >> 8 & 0xf800) | (px >> 5 & 0x07e0) | (px >> 3 & 0x001f),
+			     &dst[i * 2]);
+	}
+}
+
+static void store_argb4444(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t px = src[i];
+
+		sys_put_le16((px >> 16 & 0xf000) | (px >> 12 & 0x0f00) | (px >> 8 & 0x00f0) |
+				     (px >> 4 & 0x000f),
+			     &dst[i * 2]);
+	}
+}
+
+static void store_argb1555(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t px = src[i];
+
+		sys_put_le16((px >> 16 & 0x8000) | (px >> 9 & 0x7c00) | (px >> 6 & 0x03e0) |
+				     (px >> 3 & 0x001f),
+			     &dst[i * 2]);
+	}
+}
+
+static void store_rgba4444(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t px = src[i];
+
+		sys_put_le16((px >> 8 & 0xf000) | (px >> 4 & 0x0f00) | (px & 0x00f0) |
+				     (px >> 28 & 0x000f),
+			     &dst[i * 2]);
+	}
+}
+
+static void store_rgba5551(const uint32_t *src, uint8_t *dst, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t px = src[i];
+
+		sys_put_le16((px >> 8 & 0xf800) | (px >> 5 & 0x07c0) | (px >> 2 & 0x003e) |
+				     (px >> 31),
+			     &dst[i * 2]);
+	}
+}
+
+static store_fn_t store_function(uint32_t format)
+{
+	switch (format) {
+	case COLOR_ALPHA8:
+		return store_alpha8;
+	case COLOR_ARGB8888:
+		return store_argb8888;
+	case COLOR_ARGB4444:
+		return store_argb4444;
+	case COLOR_ARGB1555:
+		return store_argb1555;
+	case COLOR_RGBA8888:
+		return store_rgba8888;
+	case COLOR_RGBA4444:
+		return store_rgba4444;
+	case COLOR_RGBA5551:
+		return store_rgba5551;
+	case COLOR_RGB888:
+		return store_rgb888;
+	case COLOR_RGB565:
+		return store_rgb565;
+	default:
+		return NULL;
+	}
+}
+
+uint32_t asset_bytes_per_pixel(uint32_t format)
+{
+	switch (format) {
+	case COLOR_ALPHA8:
+		return 1;
+	case COLOR_ARGB4444:
+	case COLOR_ARGB1555:
+	case COLOR_RGBA4444:
+	case COLOR_RGBA5551:
+	case COLOR_RGB565:
+		return 2;
+	case COLOR_RGB888:
+		return 3;
+	case COLOR_ARGB8888:
+	case COLOR_RGBA8888:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+int asset_decoder_init(asset_decoder_t *decoder, const compressed_image_t *image)
+{
+	if (image->width == 0 || image->height == 0 || image->band_height == 0) {
+		return -EINVAL;
+	}
+
+	for (uint32_t band = 0; band < num_bands(image); ++band) {
+		uint32_t next = band + 1 < num_bands(image) ? image->band_offsets[band + 1]
+							    : image->data_size;
+
+		if (image->band_offsets[band] > next) {
+			return -EINVAL;
+		}
+	}
+
+	decoder->image = image;
+	decoder->row = 0;
+	start_band(decoder, 0);
+
+	return 0;
+}
+
+int asset_decoder_seek(asset_decoder_t *decoder, uint32_t row)
+{
+	const compressed_image_t *image = decoder->image;
+	uint32_t chunk[CHUNK_PIXELS];
+
+	if (row >= image->height) {
+		return -EINVAL;
+	}
+
+	start_band(decoder, row / image->band_height);
+	decoder->row = row;
+
+	/* Rows before row in its band */
+	uint32_t skip = (row % image->band_height) * image->width;
+
+	while (skip > 0) {
+		uint32_t count = MIN(skip, CHUNK_PIXELS);
+		int ret = decode_pixels(decoder, chunk, count);
+
+		if (ret) {
+			return ret;
+		}
+		skip -= count;
+	}
+
+	return 0;
+}
+
+int asset_decode_rows(asset_decoder_t *decoder, void *dst, uint32_t pitch, uint32_t rows,
+		      uint32_t format)
+{
+	const compressed_image_t *image = decoder->image;
+	store_fn_t store = store_function(format);
+	uint32_t bpp = asset_bytes_per_pixel(format);
+	uint32_t chunk[CHUNK_PIXELS];
+
+	if (store == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (rows > image->height - decoder->row || pitch < image->width) {
+		return -EINVAL;
+	}
+
+	for (uint32_t y = 0; y < rows; ++y) {
+		uint8_t *dst_row = (uint8_t *)dst + y * pitch * bpp;
+
+		if (decoder->row % image->band_height == 0) {
+			start_band(decoder, decoder->row / image->band_height);
+		}
+
+		for (uint32_t x = 0; x < image->width; x += CHUNK_PIXELS) {
+			uint32_t count = MIN(image->width - x, CHUNK_PIXELS);
+			int ret = decode_pixels(decoder, chunk, count);
+
+			if (ret) {
+				return ret;
+			}
+			store(chunk, dst_row + x * bpp, count);
+		}
+
+		++decoder->row;
+	}
+
+	return 0;
+}
+
+int asset_decode(const compressed_image_t *image, image_t *dst)
+{
+	asset_decoder_t decoder;
+	int ret;
+
+	if (dst->width != image->width || dst->height != image->height) {
+		return -EINVAL;
+	}
+
+	ret = asset_decoder_init(&decoder, image);
+	if (ret) {
+		return ret;
+	}
+
+	return asset_decode_rows(&decoder, dst->data, dst->pitch, image->height, dst->format);
+}
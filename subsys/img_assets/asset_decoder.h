@@ -0,0 +1,82 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file asset_decoder.h
+ *
+ * Streaming decoder of compressed image assets. Rows are decoded in order, a few at a time if
+ * needed, straight into the destination format, so an image can be produced band by band into
+ * a small buffer as well as in one go into video memory.
+ *
+ * Destination formats: ALPHA8 (average of R, G and B), ARGB8888, ARGB4444, ARGB1555, RGBA8888,
+ * RGBA4444, RGBA5551, RGB888 and RGB565. Channels are truncated.
+ */
+
+#ifndef ASSET_DECODER_H
+#define ASSET_DECODER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "assets.h"
+
+typedef struct {
+	const compressed_image_t *image;
+	/* Next row to decode */
+	uint32_t row;
+	uint32_t pos;
+	/* End of the band being decoded */
+	uint32_t end;
+	uint32_t run;
+	/* ARGB8888 */
+	uint32_t px;
+	uint32_t index[64];
+} asset_decoder_t;
+
+/* Bytes per pixel of a destination format, 0 if it is not supported */
+uint32_t asset_bytes_per_pixel(uint32_t format);
+
+/* @return 0, or -EINVAL if the image is not valid */
+int asset_decoder_init(asset_decoder_t *decoder, const compressed_image_t *image);
+
+/**
+ * Continue decoding at row. The band containing it is decoded from its start, the rows before
+ * row are skipped.
+ *
+ * @return 0, -EINVAL if row is past the image, -EBADMSG if the data is corrupt
+ */
+int asset_decoder_seek(asset_decoder_t *decoder, uint32_t row);
+
+/**
+ * Decode the next rows, full width, into dst.
+ *
+ * @param pitch  dst row length in pixels
+ *
+ * @return 0, -EINVAL if there are fewer rows left, -ENOTSUP for an unsupported format,
+ *         -EBADMSG if the data is corrupt
+ */
+int asset_decode_rows(asset_decoder_t *decoder, void *dst, uint32_t pitch, uint32_t rows,
+		      uint32_t format);
+
+/**
+ * Decode a whole image into dst, which sets the data, pitch and format. Its width and height
+ * must be the ones of the image.
+ *
+ * @return as asset_decode_rows()
+ */
+int asset_decode(const compressed_image_t *image, image_t *dst);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /* ASSET_DECODER_H */
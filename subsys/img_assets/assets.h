@@ -48,21 +48,28 @@ typedef struct {
 	uint32_t format;
 } image_t;
 
+/*
+ * Image stored once, as ARGB8888 pixels compressed with the QOI operations, and decoded on
+ * demand to the format needed (see asset_decoder.h). The encoder state is reset at the start
+ * of every band of band_height rows, so bands can be decoded independently.
+ *
+ * Generated by scripts/img_assets/encode_img_asset.py.
+ */
+typedef struct {
+	const uint8_t *data;
+	uint32_t data_size;
+	uint32_t width;
+	uint32_t height;
+	uint32_t band_height;
+	/* Offset in data of every band, the last one ends at data_size */
+	const uint32_t *band_offsets;
+} compressed_image_t;
+
 #define ASSET_PREFIX
 
 #ifndef ASSET_INTERNAL
-extern const image_t SAMPLE_PHOTO_RGB888;
-extern const image_t SAMPLE_PHOTO_ARGB8888;
-extern const image_t SAMPLE_PHOTO_ARGB4444;
-extern const image_t SAMPLE_PHOTO_ARGB1555;
-extern const image_t SAMPLE_PHOTO_RGBA8888;
-extern const image_t SAMPLE_PHOTO_RGBA4444;
-extern const image_t SAMPLE_PHOTO_RGBA5551;
-extern const image_t SAMPLE_PHOTO_RGB565;
-extern const image_t SAMPLE_PHOTO_ALPHA8;
-extern const image_t SAMPLE_PHOTO_ALPHA4;
-extern const image_t SAMPLE_PHOTO_ALPHA2;
-extern const image_t SAMPLE_PHOTO_ALPHA1;
+/* 480x360 */
+extern const compressed_image_t SAMPLE_PHOTO;
 #endif
 
 #endif /* ASSETS_H */
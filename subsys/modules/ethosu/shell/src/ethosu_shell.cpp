@@ -7,6 +7,9 @@
  * contact@alifsemi.com, or visit: https://alifsemi.com/license
  */
 #include "inference_process.hpp"
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+#include "layer_profiler.hpp"
+#endif
 
 #include "ethosu/models/keyword_spotting_cnn_small_int8/u55/input.h"
 #include "ethosu/models/keyword_spotting_cnn_small_int8/u55/output.h"
@@ -21,6 +24,7 @@
 #include <inttypes.h>
 #include <string>
 #include <stdio.h>
+#include <string.h>
 #include <vector>
 #include <zephyr/kernel.h>
 
@@ -32,6 +36,18 @@ static atomic_t ethosu_running = 0;
 __attribute__((section(".bss.tflm_arena"),
 	       aligned(16))) static uint8_t tensor_arena[TENSOR_ARENA_SIZE];
 
+static InferenceProcess::InferenceJob ethosu_job(void)
+{
+	return InferenceProcess::InferenceJob(
+		modelName,
+		InferenceProcess::DataPtr(const_cast<uint8_t *>(networkModelData),
+					  sizeof(networkModelData)),
+		{InferenceProcess::DataPtr(const_cast<uint8_t *>(inputData), sizeof(inputData))},
+		{},
+		{InferenceProcess::DataPtr(const_cast<uint8_t *>(expectedOutputData),
+					   sizeof(expectedOutputData))});
+}
+
 static void ethosu_worker(void *, void *, void *)
 {
 	InferenceProcess::InferenceProcess npu(tensor_arena, TENSOR_ARENA_SIZE);
@@ -43,15 +59,7 @@ static void ethosu_worker(void *, void *, void *)
 			break;
 		}
 
-		InferenceProcess::InferenceJob job(
-			modelName,
-			InferenceProcess::DataPtr(const_cast<uint8_t *>(networkModelData),
-						  sizeof(networkModelData)),
-			{InferenceProcess::DataPtr(const_cast<uint8_t *>(inputData),
-						   sizeof(inputData))},
-			{},
-			{InferenceProcess::DataPtr(const_cast<uint8_t *>(expectedOutputData),
-						   sizeof(expectedOutputData))});
+		InferenceProcess::InferenceJob job = ethosu_job();
 
 		status = npu.runJob(job);
 		jobcnt++;
@@ -94,8 +102,61 @@ static int cmd_stop(const struct shell *shell, size_t, char **)
 	return 0;
 }
 
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+static InferenceProcess::LayerProfiler ethosu_profiler;
+
+static void ethosu_profile_worker(void *csv, void *, void *)
+{
+	InferenceProcess::InferenceProcess npu(tensor_arena, TENSOR_ARENA_SIZE);
+	InferenceProcess::InferenceJob job = ethosu_job();
+
+	npu.setProfiler(&ethosu_profiler);
+
+	/* Warm up run opens the session, profile the steady state one */
+	if (npu.runJob(job)) {
+		printk("%s profiling failed\n", modelName);
+		return;
+	}
+
+	ethosu_profiler.reset();
+
+	if (npu.runJob(job)) {
+		printk("%s profiling failed\n", modelName);
+		return;
+	}
+
+	if (csv != NULL) {
+		ethosu_profiler.printCsv();
+	} else {
+		ethosu_profiler.print();
+	}
+}
+
+static int cmd_profile(const struct shell *shell, size_t argc, char **argv)
+{
+	bool csv = argc > 1 && strcmp(argv[1], "csv") == 0;
+
+	if (atomic_set(&ethosu_running, 1) == 1) {
+		shell_fprintf(shell, SHELL_VT100_COLOR_DEFAULT,
+			      "Stop Ethos-U55 inferencing before profiling\n");
+		return -1;
+	}
+
+	k_thread_create(&ethosu_thread, ethosu_stack, K_THREAD_STACK_SIZEOF(ethosu_stack),
+			ethosu_profile_worker, csv ? &ethosu_profiler : NULL, NULL, NULL,
+			CONFIG_ALIF_ETHOSU_SHELL_THREAD_PRIORITY, 0, K_NO_WAIT);
+	k_thread_join(&ethosu_thread, K_FOREVER);
+
+	atomic_set(&ethosu_running, 0);
+	return 0;
+}
+#endif
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmds, SHELL_CMD_ARG(start, NULL, "start", cmd_start, 1, 10),
 			       SHELL_CMD_ARG(stop, NULL, "stop", cmd_stop, 1, 10),
+#if defined(CONFIG_ALIF_ETHOSU_PROFILER)
+			       SHELL_CMD_ARG(profile, NULL, "profile [csv]", cmd_profile, 1, 1),
+#endif
 			       SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(ethosu, &sub_cmds, "Ethos-U55 commands", NULL);
@@ -0,0 +1,223 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "pipeline.h"
+#include "aipl_color_conversion.h"
+#include "aipl_crop.h"
+#include "aipl_lut_transform.h"
+#include "aipl_video_alloc.h"
+#include "aipl_white_balance.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define SRC_WIDTH  64
+#define SRC_HEIGHT 48
+/* Large enough for any of the output sizes below */
+#define MAX_PIXELS (128 * 96)
+
+/* From a full frame down to less than one row of the source */
+static const uint32_t scratch_sizes[] = {1024, 3000, 9000, 40000, 262144};
+
+static uint8_t src_data[SRC_WIDTH * SRC_HEIGHT * 4];
+static uint8_t ref_data[MAX_PIXELS * 4];
+static uint8_t tmp_data[2][MAX_PIXELS * 4];
+static uint8_t out_data[MAX_PIXELS * 4];
+static uint8_t scratch[262144] __aligned(4);
+static uint8_t lut[256];
+
+static aipl_image_t src = {src_data, SRC_WIDTH, SRC_WIDTH, SRC_HEIGHT, AIPL_COLOR_ARGB8888};
+
+void *aipl_video_alloc(uint32_t size)
+{
+	return k_malloc(size);
+}
+
+void aipl_video_free(void *ptr)
+{
+	k_free(ptr);
+}
+
+static aipl_image_t make_image(void *data, uint32_t width, uint32_t height, uint32_t format)
+{
+	aipl_image_t image = {data, width, width, height, format};
+
+	return image;
+}
+
+static void *pipeline_setup(void)
+{
+	uint32_t state = 1;
+
+	for (size_t i = 0; i < sizeof(src_data); i++) {
+		state = state * 1664525u + 1013904223u;
+		src_data[i] = state >> 24;
+	}
+
+	for (int i = 0; i < 256; i++) {
+		lut[i] = 255 - i;
+	}
+
+	return NULL;
+}
+
+/* Crop, resize, RGB888, white balance and LUT through full-size images */
+static void run_unfused(uint32_t left, uint32_t top, uint32_t right, uint32_t bottom,
+			aipl_image_t *ref)
+{
+	aipl_image_t crop = make_image(tmp_data[0], right - left, bottom - top, src.format);
+	aipl_image_t resized = make_image(tmp_data[1], ref->width, ref->height, src.format);
+	aipl_image_t converted =
+		make_image(tmp_data[0], ref->width, ref->height, AIPL_COLOR_RGB888);
+	aipl_image_t balanced = make_image(tmp_data[1], ref->width, ref->height, AIPL_COLOR_RGB888);
+
+	zassert_equal(aipl_crop_img(&src, &crop, left, top, right, bottom), AIPL_ERR_OK);
+	zassert_equal(pipeline_resize_img(&crop, &resized), 0);
+	zassert_equal(aipl_color_convert_img(&resized, &converted), AIPL_ERR_OK);
+	zassert_equal(aipl_white_balance_rgb_img(&converted, &balanced, 1.2f, 0.8f, 0.6f),
+		      AIPL_ERR_OK);
+	zassert_equal(aipl_lut_transform_rgb_img(&balanced, ref, lut), AIPL_ERR_OK);
+}
+
+static void check_fused(uint32_t left, uint32_t top, uint32_t right, uint32_t bottom,
+			uint32_t width, uint32_t height)
+{
+	aipl_image_t ref = make_image(ref_data, width, height, AIPL_COLOR_RGB888);
+	pipeline_t pipeline;
+
+	run_unfused(left, top, right, bottom, &ref);
+
+	pipeline_init(&pipeline);
+	zassert_ok(pipeline_add_crop(&pipeline, left, top, right, bottom));
+	zassert_ok(pipeline_add_resize(&pipeline, width, height));
+	zassert_ok(pipeline_add_color_conversion(&pipeline, AIPL_COLOR_RGB888));
+	zassert_ok(pipeline_add_white_balance(&pipeline, 1.2f, 0.8f, 0.6f));
+	zassert_ok(pipeline_add_lut_transform(&pipeline, lut));
+
+	for (size_t i = 0; i < ARRAY_SIZE(scratch_sizes); i++) {
+		aipl_image_t out = make_image(out_data, width, height, AIPL_COLOR_RGB888);
+		uint32_t rows = pipeline_stripe_height(&pipeline, &src, scratch_sizes[i]);
+		int ret;
+
+		memset(out_data, 0, sizeof(out_data));
+		ret = pipeline_run(&pipeline, &src, &out, scratch, scratch_sizes[i]);
+
+		if (rows == 0) {
+			zassert_equal(ret, -ENOMEM);
+			continue;
+		}
+
+		zassert_ok(ret);
+		zassert_mem_equal(out_data, ref_data, width * height * 3,
+				  "%ux%u to %ux%u differs with %u rows stripes", right - left,
+				  bottom - top, width, height, rows);
+	}
+}
+
+ZTEST(aipl_pipeline, test_fused_matches_unfused)
+{
+	check_fused(0, 0, SRC_WIDTH, SRC_HEIGHT, SRC_WIDTH, SRC_HEIGHT);
+	check_fused(5, 3, 61, 45, 28, 21);
+	check_fused(5, 3, 61, 45, 100, 77);
+	check_fused(1, 1, 32, 16, 7, 3);
+	check_fused(0, 10, SRC_WIDTH, 11, 128, 1);
+}
+
+ZTEST(aipl_pipeline, test_pointwise_only)
+{
+	aipl_image_t converted = make_image(tmp_data[0], SRC_WIDTH, SRC_HEIGHT, AIPL_COLOR_RGB888);
+	aipl_image_t ref = make_image(ref_data, SRC_WIDTH, SRC_HEIGHT, AIPL_COLOR_RGB888);
+	pipeline_t pipeline;
+
+	zassert_equal(aipl_color_convert_img(&src, &converted), AIPL_ERR_OK);
+	zassert_equal(aipl_lut_transform_rgb_img(&converted, &ref, lut), AIPL_ERR_OK);
+
+	pipeline_init(&pipeline);
+	zassert_ok(pipeline_add_color_conversion(&pipeline, AIPL_COLOR_RGB888));
+	zassert_ok(pipeline_add_lut_transform(&pipeline, lut));
+
+	for (size_t i = 0; i < ARRAY_SIZE(scratch_sizes); i++) {
+		aipl_image_t out = make_image(out_data, SRC_WIDTH, SRC_HEIGHT, AIPL_COLOR_RGB888);
+
+		zassert_ok(pipeline_run(&pipeline, &src, &out, scratch, scratch_sizes[i]));
+		zassert_mem_equal(out_data, ref_data, SRC_WIDTH * SRC_HEIGHT * 3);
+	}
+}
+
+ZTEST(aipl_pipeline, test_identity_resize)
+{
+	aipl_image_t out = make_image(out_data, SRC_WIDTH, SRC_HEIGHT, src.format);
+
+	zassert_ok(pipeline_resize_img(&src, &out));
+	zassert_mem_equal(out_data, src_data, sizeof(src_data));
+}
+
+ZTEST(aipl_pipeline, test_crop_only)
+{
+	aipl_image_t out = make_image(out_data, 10, 4, src.format);
+	pipeline_t pipeline;
+
+	pipeline_init(&pipeline);
+	zassert_ok(pipeline_add_crop(&pipeline, 7, 2, 17, 6));
+
+	/* No stripe buffers needed */
+	zassert_ok(pipeline_run(&pipeline, &src, &out, NULL, 0));
+
+	for (uint32_t y = 0; y < 4; y++) {
+		zassert_mem_equal(&out_data[y * 10 * 4], &src_data[((2 + y) * SRC_WIDTH + 7) * 4],
+				  10 * 4);
+	}
+}
+
+ZTEST(aipl_pipeline, test_errors)
+{
+	aipl_image_t out = make_image(out_data, 32, 24, AIPL_COLOR_RGB888);
+	aipl_image_t planar = make_image(src_data, SRC_WIDTH, SRC_HEIGHT, AIPL_COLOR_I420);
+	aipl_image_t rgb565 = make_image(src_data, SRC_WIDTH, SRC_HEIGHT, AIPL_COLOR_RGB565);
+	pipeline_t pipeline;
+
+	pipeline_init(&pipeline);
+	zassert_ok(pipeline_add_resize(&pipeline, 32, 24));
+	zassert_ok(pipeline_add_color_conversion(&pipeline, AIPL_COLOR_RGB888));
+
+	zassert_equal(pipeline_run(&pipeline, &planar, &out, scratch, sizeof(scratch)),
+		      -ENOTSUP);
+	/* Channels are not bytes */
+	zassert_equal(pipeline_run(&pipeline, &rgb565, &out, scratch, sizeof(scratch)),
+		      -ENOTSUP);
+	zassert_equal(pipeline_run(&pipeline, &src, &out, scratch, 16), -ENOMEM);
+
+	out.width = 31;
+	zassert_equal(pipeline_run(&pipeline, &src, &out, scratch, sizeof(scratch)), -EINVAL);
+
+	out.width = 32;
+
+	/* Crop must be the first stage, with a single resize */
+	zassert_ok(pipeline_add_crop(&pipeline, 0, 0, 8, 8));
+	zassert_equal(pipeline_run(&pipeline, &src, &out, scratch, sizeof(scratch)), -EINVAL);
+
+	pipeline_init(&pipeline);
+	zassert_ok(pipeline_add_resize(&pipeline, 32, 24));
+	zassert_ok(pipeline_add_resize(&pipeline, 32, 24));
+	zassert_equal(pipeline_run(&pipeline, &src, &out, scratch, sizeof(scratch)), -EINVAL);
+
+	pipeline_init(&pipeline);
+	zassert_ok(pipeline_add_crop(&pipeline, 0, 0, SRC_WIDTH + 1, 8));
+	zassert_equal(pipeline_run(&pipeline, &src, &out, scratch, sizeof(scratch)), -EINVAL);
+
+	pipeline_init(&pipeline);
+	for (int i = 0; i < PIPELINE_MAX_STAGES; i++) {
+		zassert_ok(pipeline_add_lut_transform(&pipeline, lut));
+	}
+	zassert_equal(pipeline_add_lut_transform(&pipeline, lut), -ENOMEM);
+}
+
+ZTEST_SUITE(aipl_pipeline, NULL, pipeline_setup, NULL, NULL, NULL);
@@ -0,0 +1,184 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "damage.h"
+
+#include <zephyr/ztest.h>
+
+#define SCREEN_WIDTH  320
+#define SCREEN_HEIGHT 240
+
+BUILD_ASSERT(DAMAGE_MAX_RECTS == 4, "the capacity test fills a set of 4 rectangles");
+
+static struct damage damage;
+
+static void add(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	damage_add(&damage, x, y, width, height, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+static bool has_rect(const struct damage *set, uint16_t x, uint16_t y, uint16_t width,
+		     uint16_t height)
+{
+	for (uint8_t i = 0; i < set->count; ++i) {
+		const struct damage_rect *rect = &set->rects[i];
+
+		if (rect->x == x && rect->y == y && rect->width == width &&
+		    rect->height == height) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool is_covered(const struct damage *set, uint16_t x, uint16_t y, uint16_t width,
+		       uint16_t height)
+{
+	for (uint8_t i = 0; i < set->count; ++i) {
+		const struct damage_rect *rect = &set->rects[i];
+
+		if (rect->x <= x && rect->y <= y && rect->x + rect->width >= x + width &&
+		    rect->y + rect->height >= y + height) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	damage_reset(&damage);
+}
+
+ZTEST(dbuf_display_damage, test_contained)
+{
+	add(10, 10, 100, 100);
+	add(20, 20, 10, 10);
+	zassert_equal(damage.count, 1);
+	zassert_true(has_rect(&damage, 10, 10, 100, 100));
+
+	/* A rectangle covering the set replaces it */
+	add(40, 40, 10, 10);
+	add(0, 0, 200, 200);
+	zassert_equal(damage.count, 1);
+	zassert_true(has_rect(&damage, 0, 0, 200, 200));
+}
+
+ZTEST(dbuf_display_damage, test_adjacent)
+{
+	add(0, 0, 50, 20);
+	add(50, 0, 30, 20);
+	zassert_equal(damage.count, 1);
+	zassert_true(has_rect(&damage, 0, 0, 80, 20));
+
+	add(0, 20, 80, 10);
+	zassert_equal(damage.count, 1);
+	zassert_true(has_rect(&damage, 0, 0, 80, 30));
+
+	/* With a gap the bounding box would cost more */
+	add(90, 0, 10, 30);
+	zassert_equal(damage.count, 2);
+	zassert_true(has_rect(&damage, 90, 0, 10, 30));
+
+	/* Filling the gap merges all three */
+	add(80, 0, 10, 30);
+	zassert_equal(damage.count, 1);
+	zassert_true(has_rect(&damage, 0, 0, 100, 30));
+}
+
+ZTEST(dbuf_display_damage, test_capacity)
+{
+	add(0, 0, 10, 10);
+	add(100, 0, 10, 10);
+	add(0, 100, 10, 10);
+	add(100, 100, 10, 10);
+	zassert_equal(damage.count, DAMAGE_MAX_RECTS);
+
+	/* Merged with the rectangle whose bounding box grows the least */
+	add(12, 0, 10, 10);
+	zassert_equal(damage.count, DAMAGE_MAX_RECTS);
+	zassert_true(has_rect(&damage, 0, 0, 22, 10));
+	zassert_true(has_rect(&damage, 100, 0, 10, 10));
+	zassert_true(has_rect(&damage, 0, 100, 10, 10));
+	zassert_true(has_rect(&damage, 100, 100, 10, 10));
+
+	/* Many more, the set never grows and still covers every one */
+	for (uint16_t i = 0; i < 16; ++i) {
+		add(200 + (i % 4) * 30, (i / 4) * 50, 8, 8);
+		zassert_true(damage.count <= DAMAGE_MAX_RECTS);
+	}
+
+	for (uint16_t i = 0; i < 16; ++i) {
+		zassert_true(is_covered(&damage, 200 + (i % 4) * 30, (i / 4) * 50, 8, 8),
+			     "rectangle %u lost", i);
+	}
+	zassert_true(is_covered(&damage, 0, 0, 22, 10));
+	zassert_true(is_covered(&damage, 100, 100, 10, 10));
+}
+
+ZTEST(dbuf_display_damage, test_clipping)
+{
+	add(300, 230, 50, 50);
+	zassert_equal(damage.count, 1);
+	zassert_true(has_rect(&damage, 300, 230, 20, 10));
+
+	/* Off screen or empty */
+	add(SCREEN_WIDTH, 0, 10, 10);
+	add(0, SCREEN_HEIGHT, 10, 10);
+	add(10, 10, 0, 10);
+	add(10, 10, 10, 0);
+	zassert_equal(damage.count, 1);
+
+	add(0, 0, UINT16_MAX, UINT16_MAX);
+	zassert_equal(damage.count, 1);
+	zassert_true(has_rect(&damage, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT));
+}
+
+ZTEST(dbuf_display_damage, test_merge)
+{
+	struct damage src;
+
+	damage_reset(&src);
+	add(0, 0, 10, 10);
+	damage_add(&src, 100, 100, 10, 10, SCREEN_WIDTH, SCREEN_HEIGHT);
+	damage_add(&src, 5, 0, 10, 10, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+	damage_merge(&damage, &src);
+	zassert_equal(damage.count, 2);
+	zassert_true(has_rect(&damage, 0, 0, 15, 10));
+	zassert_true(has_rect(&damage, 100, 100, 10, 10));
+
+	/* A full frame on either side gives a full frame */
+	damage_reset(&src);
+	damage_merge(&damage, &src);
+	zassert_equal(damage.count, 0);
+	zassert_false(damage_is_partial(&damage, SCREEN_WIDTH, SCREEN_HEIGHT, 50));
+
+	damage_add(&src, 100, 100, 10, 10, SCREEN_WIDTH, SCREEN_HEIGHT);
+	damage_merge(&damage, &src);
+	zassert_equal(damage.count, 0);
+}
+
+ZTEST(dbuf_display_damage, test_is_partial)
+{
+	zassert_false(damage_is_partial(&damage, SCREEN_WIDTH, SCREEN_HEIGHT, 50));
+
+	add(0, 0, 160, 100);
+	zassert_true(damage_is_partial(&damage, SCREEN_WIDTH, SCREEN_HEIGHT, 50));
+
+	/* Half the screen */
+	add(0, 100, 160, 140);
+	zassert_false(damage_is_partial(&damage, SCREEN_WIDTH, SCREEN_HEIGHT, 50));
+}
+
+ZTEST_SUITE(dbuf_display_damage, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,187 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "frame_queue.h"
+
+#include <errno.h>
+#include <zephyr/ztest.h>
+
+/* Vsync period in ms */
+#define VSYNC 16
+
+static struct frame_queue queue;
+static struct frame_flip flip;
+
+static void vsync(uint32_t now)
+{
+	frame_queue_vsync(&queue, now, &flip);
+}
+
+/* Acquire and submit the next free buffer */
+static uint8_t submit(uint32_t duration, uint32_t now)
+{
+	uint8_t index = frame_queue_acquire(&queue);
+
+	zassert_not_equal(index, FRAME_QUEUE_NONE);
+	zassert_equal(frame_queue_submit(&queue, index, duration, now), 0);
+
+	return index;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	frame_queue_init(&queue);
+}
+
+ZTEST(dbuf_display_frame_queue, test_acquire)
+{
+	/* Buffer 0 is shown */
+	zassert_equal(frame_queue_acquire(&queue), 1);
+	zassert_equal(frame_queue_acquire(&queue), 2);
+	zassert_equal(frame_queue_acquire(&queue), FRAME_QUEUE_NONE);
+
+	zassert_false(frame_queue_release(&queue, 0), "shown buffer released");
+	zassert_true(frame_queue_release(&queue, 2));
+	zassert_false(frame_queue_release(&queue, 2), "free buffer released");
+	zassert_equal(frame_queue_acquire(&queue), 2);
+}
+
+ZTEST(dbuf_display_frame_queue, test_submit)
+{
+	uint8_t index = frame_queue_acquire(&queue);
+
+	zassert_equal(frame_queue_submit(&queue, 0, 10, 0), -EINVAL, "shown buffer submitted");
+	zassert_equal(frame_queue_submit(&queue, 2, 10, 0), -EINVAL, "free buffer submitted");
+	zassert_equal(frame_queue_submit(&queue, FRAME_QUEUE_BUFFERS, 10, 0), -EINVAL);
+	zassert_equal(frame_queue_submit(&queue, index, 10, 0), 0);
+	zassert_equal(frame_queue_submit(&queue, index, 10, 0), -EINVAL, "submitted twice");
+	zassert_equal(queue.states[index], FRAME_BUFFER_QUEUED);
+	zassert_false(frame_queue_release(&queue, index), "queued buffer released");
+}
+
+ZTEST(dbuf_display_frame_queue, test_flip_and_retire)
+{
+	/* Nothing queued */
+	vsync(VSYNC);
+	zassert_equal(flip.shown, FRAME_QUEUE_NONE);
+	zassert_equal(flip.num_freed, 0);
+
+	uint8_t first = submit(20, VSYNC);
+
+	vsync(2 * VSYNC);
+	zassert_equal(flip.shown, first);
+	zassert_equal(flip.num_dropped, 0);
+	zassert_equal(flip.num_freed, 0);
+	/* Submitted after the 1 ms of the initial frame */
+	zassert_true(flip.late);
+	zassert_equal(queue.states[first], FRAME_BUFFER_SHOWN);
+
+	/* The replaced buffer may still be scanned out, it cannot be rendered to */
+	zassert_equal(queue.states[0], FRAME_BUFFER_RETIRING);
+	zassert_equal(frame_queue_acquire(&queue), 2);
+	zassert_equal(frame_queue_acquire(&queue), FRAME_QUEUE_NONE);
+
+	/* Free at the next vsync, without a new frame */
+	vsync(3 * VSYNC);
+	zassert_equal(flip.shown, FRAME_QUEUE_NONE);
+	zassert_equal(flip.num_freed, 1);
+	zassert_equal(queue.states[0], FRAME_BUFFER_FREE);
+	zassert_equal(frame_queue_acquire(&queue), 0);
+
+	vsync(4 * VSYNC);
+	zassert_equal(flip.num_freed, 0);
+}
+
+ZTEST(dbuf_display_frame_queue, test_duration)
+{
+	uint8_t first = submit(50, 0);
+
+	vsync(VSYNC);
+	zassert_equal(flip.shown, first);
+
+	uint8_t second = submit(20, VSYNC + 4);
+
+	/* The first frame stays on screen from 16 ms to 66 ms */
+	vsync(2 * VSYNC);
+	zassert_equal(flip.shown, FRAME_QUEUE_NONE);
+	vsync(3 * VSYNC);
+	zassert_equal(flip.shown, FRAME_QUEUE_NONE);
+	vsync(4 * VSYNC);
+	zassert_equal(flip.shown, FRAME_QUEUE_NONE);
+	vsync(VSYNC + 50);
+	zassert_equal(flip.shown, second);
+	zassert_false(flip.late);
+}
+
+ZTEST(dbuf_display_frame_queue, test_late)
+{
+	uint8_t first = submit(20, 0);
+
+	vsync(VSYNC);
+	zassert_equal(flip.shown, first);
+
+	/* Due at 36 ms, submitted before */
+	uint8_t second = submit(20, 30);
+
+	vsync(3 * VSYNC);
+	zassert_equal(flip.shown, second);
+	zassert_false(flip.late);
+
+	/* Due at 68 ms, submitted after */
+	uint8_t third = submit(20, 70);
+
+	vsync(5 * VSYNC);
+	zassert_equal(flip.shown, third);
+	zassert_true(flip.late);
+	zassert_equal(flip.num_dropped, 0);
+}
+
+ZTEST(dbuf_display_frame_queue, test_dropped)
+{
+	uint8_t first = submit(10, 0);
+	uint8_t second = submit(10, 0);
+
+	/* The time on screen of the first frame, 1 ms to 11 ms, passed with the second queued */
+	vsync(2 * VSYNC);
+	zassert_equal(flip.shown, second);
+	zassert_equal(flip.num_dropped, 1);
+	zassert_equal(flip.dropped[0], first);
+	zassert_equal(flip.num_freed, 1);
+	zassert_false(flip.late);
+
+	/* Dropped buffers were never scanned out, free at once */
+	zassert_equal(queue.states[first], FRAME_BUFFER_FREE);
+	zassert_equal(queue.states[0], FRAME_BUFFER_RETIRING);
+
+	/* The replaced buffer at the next vsync */
+	vsync(3 * VSYNC);
+	zassert_equal(flip.num_freed, 1);
+	zassert_equal(queue.states[0], FRAME_BUFFER_FREE);
+}
+
+ZTEST(dbuf_display_frame_queue, test_not_dropped)
+{
+	uint8_t first = submit(20, 0);
+	uint8_t second = submit(20, 0);
+
+	/* The first frame still has time on screen */
+	vsync(VSYNC);
+	zassert_equal(flip.shown, first);
+	zassert_equal(flip.num_dropped, 0);
+
+	/* The last queued frame is shown however late */
+	vsync(100 * VSYNC);
+	zassert_equal(flip.shown, second);
+	zassert_equal(flip.num_dropped, 0);
+	zassert_equal(flip.num_freed, 1);
+}
+
+ZTEST_SUITE(dbuf_display_frame_queue, NULL, NULL, before, NULL, NULL);
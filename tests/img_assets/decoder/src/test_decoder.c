@@ -0,0 +1,120 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "img_assets/asset_decoder.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/ztest.h>
+
+#define WIDTH  480
+#define HEIGHT 360
+
+static uint8_t image_data[WIDTH * HEIGHT * 4];
+static uint8_t rows_data[WIDTH * 16 * 4];
+
+/* CRC-32 of the uncompressed arrays the sample photo used to be stored as */
+static const struct {
+	uint32_t format;
+	uint32_t crc;
+} raw_assets[] = {
+	{COLOR_ALPHA8, 0xf934f9fe},   {COLOR_ARGB8888, 0x729f452e}, {COLOR_ARGB4444, 0xa454a870},
+	{COLOR_ARGB1555, 0x16ee1fb3}, {COLOR_RGBA8888, 0x7c80894a}, {COLOR_RGBA4444, 0x6196e793},
+	{COLOR_RGBA5551, 0xf01fcf1b}, {COLOR_RGB888, 0x343e24d8},   {COLOR_RGB565, 0x527b9676},
+};
+
+static image_t make_image(void *data, uint32_t format)
+{
+	image_t image = {.data = data,
+			 .data_size = WIDTH * HEIGHT * asset_bytes_per_pixel(format),
+			 .pitch = WIDTH,
+			 .width = WIDTH,
+			 .height = HEIGHT,
+			 .format = format};
+
+	return image;
+}
+
+ZTEST(img_assets_decoder, test_formats_match_raw_assets)
+{
+	zassert_equal(SAMPLE_PHOTO.width, WIDTH);
+	zassert_equal(SAMPLE_PHOTO.height, HEIGHT);
+
+	for (size_t i = 0; i < ARRAY_SIZE(raw_assets); i++) {
+		image_t image = make_image(image_data, raw_assets[i].format);
+
+		memset(image_data, 0, sizeof(image_data));
+		zassert_ok(asset_decode(&SAMPLE_PHOTO, &image));
+		zassert_equal(crc32_ieee(image_data, image.data_size), raw_assets[i].crc,
+			      "format %u differs", raw_assets[i].format);
+	}
+}
+
+ZTEST(img_assets_decoder, test_rows_and_seek)
+{
+	image_t image = make_image(image_data, COLOR_RGB888);
+	asset_decoder_t decoder;
+
+	zassert_ok(asset_decode(&SAMPLE_PHOTO, &image));
+
+	/* Row counts not matching the bands */
+	zassert_ok(asset_decoder_init(&decoder, &SAMPLE_PHOTO));
+	for (uint32_t row = 0; row < HEIGHT; row += 7) {
+		uint32_t rows = MIN(7, HEIGHT - row);
+
+		zassert_ok(asset_decode_rows(&decoder, rows_data, WIDTH, rows, COLOR_RGB888));
+		zassert_mem_equal(rows_data, &image_data[row * WIDTH * 3], rows * WIDTH * 3,
+				  "rows from %u differ", row);
+	}
+
+	/* Backwards and inside bands */
+	for (uint32_t row = HEIGHT - 1; row > 0; row -= MIN(row, 29)) {
+		zassert_ok(asset_decoder_seek(&decoder, row));
+		zassert_ok(asset_decode_rows(&decoder, rows_data, WIDTH, 1, COLOR_RGB888));
+		zassert_mem_equal(rows_data, &image_data[row * WIDTH * 3], WIDTH * 3,
+				  "row %u differs", row);
+	}
+}
+
+ZTEST(img_assets_decoder, test_errors)
+{
+	compressed_image_t truncated = SAMPLE_PHOTO;
+	image_t image = make_image(image_data, COLOR_I420);
+	uint32_t last_band = DIV_ROUND_UP(HEIGHT, SAMPLE_PHOTO.band_height) - 1;
+	asset_decoder_t decoder;
+
+	zassert_equal(asset_decode(&SAMPLE_PHOTO, &image), -ENOTSUP);
+
+	image = make_image(image_data, COLOR_ARGB8888);
+	image.width = WIDTH / 2;
+	zassert_equal(asset_decode(&SAMPLE_PHOTO, &image), -EINVAL);
+
+	zassert_ok(asset_decoder_init(&decoder, &SAMPLE_PHOTO));
+	zassert_equal(asset_decode_rows(&decoder, image_data, WIDTH - 1, 1, COLOR_ARGB8888),
+		      -EINVAL);
+	zassert_equal(asset_decoder_seek(&decoder, HEIGHT), -EINVAL);
+	zassert_ok(asset_decoder_seek(&decoder, HEIGHT - 2));
+	zassert_equal(asset_decode_rows(&decoder, image_data, WIDTH, 3, COLOR_ARGB8888), -EINVAL);
+
+	/* The last band ends before its pixels */
+	truncated.data_size = SAMPLE_PHOTO.band_offsets[last_band] + 100;
+	zassert_ok(asset_decoder_init(&decoder, &truncated));
+	zassert_ok(asset_decoder_seek(&decoder, last_band * SAMPLE_PHOTO.band_height));
+	zassert_equal(asset_decode_rows(&decoder, image_data, WIDTH,
+					HEIGHT - last_band * SAMPLE_PHOTO.band_height,
+					COLOR_ARGB8888),
+		      -EBADMSG);
+
+	/* Band offsets past the data */
+	truncated.data_size = SAMPLE_PHOTO.band_offsets[last_band] - 1;
+	zassert_equal(asset_decoder_init(&decoder, &truncated), -EINVAL);
+}
+
+ZTEST_SUITE(img_assets_decoder, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,140 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "arena_planner.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/ztest.h>
+
+using namespace InferenceProcess;
+
+/* The model headers define unscoped symbols and TENSOR_ARENA_SIZE, see tflm_benchmark */
+namespace kws
+{
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u85/model_u85_256.h"
+constexpr size_t arenaSize = TENSOR_ARENA_SIZE;
+#undef TENSOR_ARENA_SIZE
+#undef MODEL_SECTION
+} /* namespace kws */
+
+#if defined(ARENA_PLANNER_BERT_TINY)
+/* BERT-Tiny headers only declare the symbols of its C source */
+#include "ethosu/models/bert_tiny/u85/model_u85_256.h"
+
+namespace bert
+{
+constexpr size_t arenaSize = TENSOR_ARENA_SIZE;
+} /* namespace bert */
+#undef TENSOR_ARENA_SIZE
+
+/* Room for both private arenas, so that planning never fails for lack of space */
+#define ARENA_SIZE (kws::arenaSize + bert::arenaSize)
+#else
+#define ARENA_SIZE kws::arenaSize
+#endif
+
+__attribute__((section(".bss.tflm_arena"), aligned(16))) static uint8_t arena[ARENA_SIZE];
+
+static DataPtr kws_model()
+{
+	return DataPtr((void *)kws::networkModelData, sizeof(kws::networkModelData));
+}
+
+static bool overlaps(const uint8_t *a, size_t a_size, const uint8_t *b, size_t b_size)
+{
+	return a < b + b_size && b < a + a_size;
+}
+
+static void check_layout(const ArenaLayout &layout)
+{
+	zassert_equal(layout.sharedArena, arena);
+	zassert_true(layout.sharedArenaSize > 0);
+	zassert_true(layout.persistentArenaSize > 0);
+	zassert_true(layout.persistentArena >= arena);
+	zassert_true(layout.persistentArena + layout.persistentArenaSize <= arena + ARENA_SIZE);
+	zassert_false(overlaps(layout.sharedArena, layout.sharedArenaSize,
+			       layout.persistentArena, layout.persistentArenaSize),
+		      "persistent region overlaps the shared region");
+}
+
+ZTEST(arena_planner, test_kws_bert_tiny)
+{
+#if defined(ARENA_PLANNER_BERT_TINY)
+	ArenaPlanner planner(arena, sizeof(arena));
+
+	zassert_false(planner.addModel(kws_model()));
+	zassert_false(planner.addModel(DataPtr(networkModelData, networkModelDataSize)));
+	zassert_false(planner.plan());
+
+	planner.print();
+
+	ArenaLayout layouts[2];
+
+	for (size_t i = 0; i < ARRAY_SIZE(layouts); i++) {
+		zassert_false(planner.getLayout(i, layouts[i]));
+		check_layout(layouts[i]);
+	}
+
+	zassert_false(overlaps(layouts[0].persistentArena, layouts[0].persistentArenaSize,
+			       layouts[1].persistentArena, layouts[1].persistentArenaSize),
+		      "persistent regions overlap");
+
+	/* Both models run in the same shared region */
+	zassert_equal(layouts[0].sharedArenaSize, layouts[1].sharedArenaSize);
+
+	zassert_true(planner.getPeak() < planner.getUnsharedSize(), "peak %zu, unshared %zu",
+		     planner.getPeak(), planner.getUnsharedSize());
+	zassert_equal(planner.getPeak(), layouts[0].sharedArenaSize +
+						 layouts[0].persistentArenaSize +
+						 layouts[1].persistentArenaSize);
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(arena_planner, test_single_model)
+{
+	ArenaPlanner planner(arena, sizeof(arena));
+	ArenaLayout layout;
+
+	zassert_false(planner.addModel(kws_model()));
+	zassert_false(planner.plan());
+	zassert_false(planner.getLayout(0, layout));
+	check_layout(layout);
+
+	/* Nothing to share with, the plan is the private arena */
+	zassert_equal(planner.getPeak(), planner.getUnsharedSize());
+	zassert_equal(planner.getPeak(), layout.sharedArenaSize + layout.persistentArenaSize);
+	zassert_true(planner.getPeak() <= kws::arenaSize);
+}
+
+ZTEST(arena_planner, test_errors)
+{
+	ArenaPlanner empty(arena, sizeof(arena));
+	ArenaLayout layout;
+
+	zassert_true(empty.plan(), "planned without models");
+	zassert_true(empty.getLayout(0, layout), "layout before planning");
+
+	ArenaPlanner planner(arena, sizeof(arena));
+
+	zassert_false(planner.addModel(kws_model()));
+	zassert_true(planner.getLayout(0, layout), "layout before planning");
+	zassert_false(planner.plan());
+	zassert_true(planner.addModel(kws_model()), "model added after planning");
+	zassert_true(planner.getLayout(1, layout), "layout out of range");
+
+	ArenaPlanner small(arena, 1024);
+
+	zassert_false(small.addModel(kws_model()));
+	zassert_true(small.plan(), "planned in a 1 KiB arena");
+}
+
+ZTEST_SUITE(arena_planner, NULL, NULL, NULL, NULL, NULL);
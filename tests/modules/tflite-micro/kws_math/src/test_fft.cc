@@ -0,0 +1,150 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "PlatformMath.hpp"
+
+#include <math.h>
+#include <vector>
+#include <zephyr/ztest.h>
+
+using arm::app::math::FftInstance;
+using arm::app::math::FftType;
+using arm::app::math::MathUtils;
+
+static const uint16_t fft_lengths[] = {32, 64, 128, 256, 512, 1024, 2048};
+
+/* Deterministic input in [-1, 1) */
+static float next_sample(uint32_t *state)
+{
+	*state = *state * 1664525u + 1013904223u;
+
+	return static_cast<float>(static_cast<int32_t>(*state)) / 2147483648.0f;
+}
+
+/* Rounding error grows with the length, inputs are within [-1, 1) */
+static float tolerance(uint32_t fft_len)
+{
+	return 1e-6f * fft_len;
+}
+
+/* Bin k of the DFT of real or interleaved complex input */
+static void dft_bin(const std::vector<float> &input, bool complex, uint32_t k, double *real,
+		    double *imag)
+{
+	const uint32_t n = complex ? input.size() / 2 : input.size();
+
+	*real = 0;
+	*imag = 0;
+	for (uint32_t t = 0; t < n; t++) {
+		const double angle = 2 * M_PI * ((static_cast<uint64_t>(k) * t) % n) / n;
+		const double re = complex ? input[2 * t] : input[t];
+		const double im = complex ? input[2 * t + 1] : 0;
+
+		*real += re * cos(angle) + im * sin(angle);
+		*imag += im * cos(angle) - re * sin(angle);
+	}
+}
+
+/* Real FFT output has the arm_rfft_fast_f32 layout [real0, realN/2, real1, im1, ...] */
+ZTEST(kws_math_fft, test_real_fft_matches_dft)
+{
+	uint32_t state = 1;
+
+	for (size_t i = 0; i < ARRAY_SIZE(fft_lengths); i++) {
+		const uint16_t n = fft_lengths[i];
+		std::vector<float> input(n);
+		std::vector<float> output(n);
+		FftInstance instance;
+		double real;
+		double imag;
+
+		for (float &sample : input) {
+			sample = next_sample(&state);
+		}
+		const std::vector<float> reference = input;
+
+		MathUtils::FftInitF32(n, instance);
+		MathUtils::FftF32(input, output, instance);
+
+		dft_bin(reference, false, 0, &real, &imag);
+		zassert_within(output[0], real, tolerance(n), "len %u bin 0", n);
+		dft_bin(reference, false, n / 2, &real, &imag);
+		zassert_within(output[1], real, tolerance(n), "len %u bin N/2", n);
+
+		for (uint32_t k = 1; k < n / 2u; k++) {
+			dft_bin(reference, false, k, &real, &imag);
+			zassert_within(output[2 * k], real, tolerance(n), "len %u bin %u real", n, k);
+			zassert_within(output[2 * k + 1], imag, tolerance(n), "len %u bin %u imag",
+				       n, k);
+		}
+	}
+}
+
+ZTEST(kws_math_fft, test_complex_fft_matches_dft)
+{
+	uint32_t state = 2;
+
+	for (size_t i = 0; i < ARRAY_SIZE(fft_lengths); i++) {
+		const uint16_t n = fft_lengths[i];
+		std::vector<float> input(2 * n);
+		std::vector<float> output(2 * n);
+		FftInstance instance;
+		double real;
+		double imag;
+
+		for (float &sample : input) {
+			sample = next_sample(&state);
+		}
+		const std::vector<float> reference = input;
+
+		MathUtils::FftInitF32(n, instance, FftType::complex);
+		MathUtils::FftF32(input, output, instance);
+
+		for (uint32_t k = 0; k < n; k++) {
+			dft_bin(reference, true, k, &real, &imag);
+			zassert_within(output[2 * k], real, tolerance(n), "len %u bin %u real", n, k);
+			zassert_within(output[2 * k + 1], imag, tolerance(n), "len %u bin %u imag",
+				       n, k);
+		}
+	}
+}
+
+ZTEST(kws_math_fft, test_real_fft_layout)
+{
+	const uint16_t n = 256;
+	const uint32_t bin = 5;
+	std::vector<float> input(n);
+	std::vector<float> output(n);
+	FftInstance instance;
+
+	MathUtils::FftInitF32(n, instance);
+
+	/* Cosine at bin 5: N/2 at real5 only */
+	for (uint32_t t = 0; t < n; t++) {
+		input[t] = cosf(static_cast<float>(2 * M_PI * bin * t / n));
+	}
+	MathUtils::FftF32(input, output, instance);
+
+	for (uint32_t i = 0; i < n; i++) {
+		zassert_within(output[i], i == 2 * bin ? n / 2.0f : 0.0f, tolerance(n), "index %u",
+			       i);
+	}
+
+	/* Alternating signal: N at realN/2 only */
+	for (uint32_t t = 0; t < n; t++) {
+		input[t] = t & 1 ? -1.0f : 1.0f;
+	}
+	MathUtils::FftF32(input, output, instance);
+
+	for (uint32_t i = 0; i < n; i++) {
+		zassert_within(output[i], i == 1 ? n : 0.0f, tolerance(n), "index %u", i);
+	}
+}
+
+ZTEST_SUITE(kws_math_fft, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,132 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "MicroNetKwsMfcc.hpp"
+
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+#include <zephyr/ztest.h>
+
+using arm::app::audio::MicroNetKwsMFCC;
+using arm::app::audio::MicroNetKwsMfccQ15;
+
+/* MicroNet frames, one second of audio */
+#define NUM_FEATURES 10
+#define FRAME_LEN    640
+#define FRAME_STRIDE 320
+#define SAMPLE_RATE  16000
+#define AUDIO_LEN    SAMPLE_RATE
+
+/*
+ * Largest difference allowed per coefficient, in float MFCC units and in int8 steps. The
+ * signals below stay within 0.13 and one step, tools/mfcc_accuracy measures up to 0.22 on
+ * its noisy corpus. Pure tones are not checked: their weak mel bands fall below the Q15
+ * resolution, see CONFIG_KWS_MFCC_FIXED_POINT.
+ */
+#define MAX_FEATURE_ERROR 0.25f
+#define MAX_INT8_DIFF     1
+
+#define QUANT_SCALE  0.8f
+#define QUANT_OFFSET -12
+
+static MicroNetKwsMFCC mfcc(NUM_FEATURES, FRAME_LEN);
+static MicroNetKwsMfccQ15 mfcc_q15(NUM_FEATURES, FRAME_LEN);
+
+static int16_t audio[AUDIO_LEN];
+
+/* Deterministic input in [-1, 1) */
+static float next_sample(uint32_t *state)
+{
+	*state = *state * 1664525u + 1013904223u;
+
+	return static_cast<float>(static_cast<int32_t>(*state)) / 2147483648.0f;
+}
+
+/* Chirp from freq_start to freq_end over the second, plus white noise */
+static void make_signal(float amplitude, float freq_start, float freq_end, float noise)
+{
+	uint32_t state = 1;
+	double phase = 0;
+
+	for (size_t i = 0; i < AUDIO_LEN; i++) {
+		const double t = static_cast<double>(i) / SAMPLE_RATE;
+		const float value = amplitude * static_cast<float>(sin(phase)) +
+				    noise * next_sample(&state);
+
+		phase += 2 * M_PI * (freq_start + (freq_end - freq_start) * t) / SAMPLE_RATE;
+		audio[i] = static_cast<int16_t>(lroundf(fmaxf(fminf(value * 32767.0f, 32767.0f),
+							      -32768.0f)));
+	}
+}
+
+static void check_features(void)
+{
+	std::vector<int16_t> frame(FRAME_LEN);
+	int32_t features[NUM_FEATURES];
+	int8_t quant[NUM_FEATURES];
+
+	for (size_t start = 0; start + FRAME_LEN <= AUDIO_LEN; start += FRAME_STRIDE) {
+		frame.assign(audio + start, audio + start + FRAME_LEN);
+
+		const std::vector<float> reference = mfcc.MfccCompute(frame);
+		const std::vector<int8_t> reference_quant =
+			mfcc.MfccComputeQuant<int8_t>(frame, QUANT_SCALE, QUANT_OFFSET);
+
+		mfcc_q15.MfccCompute(frame.data(), features);
+		mfcc_q15.MfccComputeQuant(frame.data(), quant);
+
+		for (size_t i = 0; i < NUM_FEATURES; i++) {
+			/* Q16 features */
+			const float feature = features[i] / 65536.0f;
+
+			zassert_within(feature, reference[i], MAX_FEATURE_ERROR,
+				       "frame at %zu, feature %zu: %f, float %f", start, i,
+				       (double)feature, (double)reference[i]);
+			zassert_true(abs(quant[i] - reference_quant[i]) <= MAX_INT8_DIFF,
+				     "frame at %zu, feature %zu: int8 %d, float %d", start, i,
+				     quant[i], reference_quant[i]);
+		}
+	}
+}
+
+static void *mfcc_setup(void)
+{
+	mfcc.Init();
+	zassert_true(mfcc_q15.Init());
+	mfcc_q15.SetQuantisation(QUANT_SCALE, QUANT_OFFSET);
+
+	return NULL;
+}
+
+ZTEST(kws_math_mfcc_q15, test_silence)
+{
+	make_signal(0.0f, 0.0f, 0.0f, 0.0f);
+	check_features();
+}
+
+ZTEST(kws_math_mfcc_q15, test_noise)
+{
+	make_signal(0.0f, 0.0f, 0.0f, 0.1f);
+	check_features();
+}
+
+ZTEST(kws_math_mfcc_q15, test_quiet_noise)
+{
+	make_signal(0.0f, 0.0f, 0.0f, 0.001f);
+	check_features();
+}
+
+ZTEST(kws_math_mfcc_q15, test_chirp_in_noise)
+{
+	make_signal(0.1f, 200.0f, 3000.0f, 0.1f);
+	check_features();
+}
+
+ZTEST_SUITE(kws_math_mfcc_q15, NULL, mfcc_setup, NULL, NULL, NULL);
@@ -0,0 +1,166 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "KwsProcessing.hpp"
+#include "ethosu/AudioRingBuffer.h"
+
+#include <math.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+using arm::app::KwsPreProcess;
+using arm::app::KwsStreamingPreProcess;
+
+/* MicroNet: 49 frames of 10 features, 640 sample frames every 320 samples */
+#define NUM_FEATURES 10
+#define NUM_FRAMES   49
+#define FRAME_LEN    640
+#define FRAME_STRIDE 320
+#define WINDOW_LEN   (NUM_FRAMES * FRAME_STRIDE + FRAME_LEN - FRAME_STRIDE)
+#define MAX_STRIDE   8000
+#define AUDIO_LEN    (WINDOW_LEN + 4 * MAX_STRIDE)
+
+static const size_t strides[] = {FRAME_STRIDE, 3200, MAX_STRIDE};
+
+static int16_t audio[AUDIO_LEN];
+/* Window plus one stride, as the KWS samples capture into */
+static int16_t ring_storage[WINDOW_LEN + MAX_STRIDE];
+#if !defined(CONFIG_KWS_MFCC_FIXED_POINT)
+static int16_t window_copy[WINDOW_LEN];
+#endif
+static float streaming_data[NUM_FRAMES * NUM_FEATURES];
+static float reference_data[NUM_FRAMES * NUM_FEATURES];
+
+/* TfLiteFloatArray and TfLiteIntArray of one element */
+static struct {
+	int size;
+	float data[1];
+} quant_scale = {1, {0.8f}};
+
+static struct {
+	int size;
+	int data[1];
+} quant_zero_point = {1, {-12}};
+
+static TfLiteAffineQuantization quant_params = {
+	reinterpret_cast<TfLiteFloatArray *>(&quant_scale),
+	reinterpret_cast<TfLiteIntArray *>(&quant_zero_point), 0};
+
+static TfLiteTensor make_tensor(float *data, bool quantised)
+{
+	TfLiteTensor tensor = {};
+
+	tensor.data.data = data;
+	if (quantised) {
+		tensor.type = kTfLiteInt8;
+		tensor.quantization.type = kTfLiteAffineQuantization;
+		tensor.quantization.params = &quant_params;
+	} else {
+		tensor.type = kTfLiteFloat32;
+		tensor.quantization.type = kTfLiteNoQuantization;
+	}
+
+	return tensor;
+}
+
+/* Syllable-like tones with a 4 Hz envelope over noise, deterministic */
+static void *make_audio(void)
+{
+	uint32_t state = 1;
+
+	for (size_t i = 0; i < AUDIO_LEN; i++) {
+		const float t = i / 16000.0f;
+		const float envelope = 0.5f * (1.0f - cosf(static_cast<float>(2 * M_PI * 4) * t));
+
+		state = state * 1664525u + 1013904223u;
+		audio[i] = static_cast<int16_t>(
+			envelope * (8000.0f * sinf(static_cast<float>(2 * M_PI * 300) * t) +
+				    4000.0f * sinf(static_cast<float>(2 * M_PI * 1200) * t)) +
+			static_cast<int32_t>(state >> 22) - 512);
+	}
+
+	return nullptr;
+}
+
+/*
+ * Audio arrives stride by stride in a ring buffer. After each stride the features of the
+ * streaming pre-processing, which only computes the new frames, must be the ones computed
+ * from scratch on the whole window.
+ */
+static void check_streaming(bool quantised)
+{
+	const size_t featureBytes = NUM_FRAMES * NUM_FEATURES * (quantised ? 1 : sizeof(float));
+	TfLiteTensor streamingTensor = make_tensor(streaming_data, quantised);
+	TfLiteTensor referenceTensor = make_tensor(reference_data, quantised);
+
+	for (size_t i = 0; i < ARRAY_SIZE(strides); i++) {
+		const size_t stride = strides[i];
+		KwsStreamingPreProcess streaming(&streamingTensor, NUM_FEATURES, NUM_FRAMES,
+						 FRAME_LEN, FRAME_STRIDE);
+#if defined(CONFIG_KWS_MFCC_FIXED_POINT)
+		/* The batch pre-processing has no fixed-point MFCC, recompute the window */
+		KwsStreamingPreProcess reference(&referenceTensor, NUM_FEATURES, NUM_FRAMES,
+						 FRAME_LEN, FRAME_STRIDE);
+#else
+		KwsPreProcess reference(&referenceTensor, NUM_FEATURES, NUM_FRAMES, FRAME_LEN,
+					FRAME_STRIDE);
+#endif
+		AudioRingBuffer<int16_t> ring(ring_storage, WINDOW_LEN + stride);
+
+		zassert_equal(streaming.m_audioDataWindowSize, WINDOW_LEN);
+		memset(ring_storage, 0, sizeof(ring_storage));
+
+		for (size_t pos = 0; pos + stride <= AUDIO_LEN; pos += stride) {
+			memcpy(ring.GetWritePointer(), &audio[pos], stride * sizeof(int16_t));
+			ring.Commit(stride);
+
+			const AudioRingWindow<int16_t> window = ring.GetWindow(WINDOW_LEN);
+
+			zassert_true(streaming.DoPreProcess(window, stride));
+#if defined(CONFIG_KWS_MFCC_FIXED_POINT)
+			reference.Reset();
+			zassert_true(reference.DoPreProcess(window, stride));
+#else
+			window.CopyTo(0, WINDOW_LEN, window_copy);
+			zassert_true(reference.DoPreProcess(window_copy));
+#endif
+			zassert_mem_equal(streaming_data, reference_data, featureBytes,
+					  "stride %zu, audio up to %zu differs", stride,
+					  pos + stride);
+		}
+	}
+}
+
+ZTEST(kws_math_streaming, test_int8_features)
+{
+	check_streaming(true);
+}
+
+ZTEST(kws_math_streaming, test_float_features)
+{
+	if (IS_ENABLED(CONFIG_KWS_MFCC_FIXED_POINT)) {
+		/* The fixed-point MFCC only fills int8 tensors */
+		ztest_test_skip();
+	}
+
+	check_streaming(false);
+}
+
+ZTEST(kws_math_streaming, test_invalid_audio)
+{
+	TfLiteTensor tensor = make_tensor(streaming_data, true);
+	KwsStreamingPreProcess streaming(&tensor, NUM_FEATURES, NUM_FRAMES, FRAME_LEN,
+					 FRAME_STRIDE);
+	AudioRingBuffer<int16_t> ring(ring_storage, WINDOW_LEN + FRAME_STRIDE);
+
+	zassert_false(streaming.DoPreProcess(ring.GetWindow(WINDOW_LEN - 1), FRAME_STRIDE));
+	zassert_false(streaming.DoPreProcess(ring.GetWindow(WINDOW_LEN), FRAME_STRIDE + 1));
+}
+
+ZTEST_SUITE(kws_math_streaming, NULL, make_audio, NULL, NULL, NULL);
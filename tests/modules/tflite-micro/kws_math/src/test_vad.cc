@@ -0,0 +1,145 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "ethosu/VoiceActivityDetector.h"
+
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#define FRAME_LEN     320
+#define QUIET_FRAMES  10
+#define VOICED_FRAMES 4
+
+/* Below the absolute energy floor, never voiced */
+static int16_t quiet[FRAME_LEN];
+/* 400 Hz square wave at -12 dBFS, few zero crossings, always voiced over the quiet floor */
+static int16_t voiced[FRAME_LEN];
+
+static void *vad_setup(void)
+{
+	for (size_t i = 0; i < FRAME_LEN; i++) {
+		quiet[i] = (i % 2) ? 3 : -3;
+		voiced[i] = ((i / 20) % 2) ? 8000 : -8000;
+	}
+
+	return NULL;
+}
+
+static VoiceActivityDetector make_vad(uint32_t onset, uint32_t hangover)
+{
+	VoiceActivityDetector::Config config;
+
+	config.frameLength = FRAME_LEN;
+	config.onsetFrames = onset;
+	config.hangoverFrames = hangover;
+
+	VoiceActivityDetector vad(config);
+
+	/* Noise floor learnt on quiet frames */
+	for (size_t i = 0; i < QUIET_FRAMES; i++) {
+		zassert_false(vad.Process(quiet, FRAME_LEN));
+	}
+
+	return vad;
+}
+
+/* Quiet frames still active after the last voiced frame */
+static uint32_t count_hangover(VoiceActivityDetector &vad, uint32_t max)
+{
+	uint32_t count = 0;
+
+	for (uint32_t i = 0; i < max; i++) {
+		if (!vad.Process(quiet, FRAME_LEN)) {
+			break;
+		}
+		count++;
+	}
+
+	return count;
+}
+
+ZTEST(kws_vad, test_onset_count)
+{
+	static const uint32_t onsets[] = {1, 2, 5};
+
+	for (size_t i = 0; i < ARRAY_SIZE(onsets); i++) {
+		VoiceActivityDetector vad = make_vad(onsets[i], 0);
+
+		for (uint32_t frame = 1; frame < onsets[i]; frame++) {
+			zassert_false(vad.Process(voiced, FRAME_LEN), "onset %u: active at frame %u",
+				      onsets[i], frame);
+		}
+
+		zassert_true(vad.Process(voiced, FRAME_LEN), "onset %u: not active", onsets[i]);
+		zassert_equal(vad.GetStats().onsets, 1);
+	}
+}
+
+ZTEST(kws_vad, test_hangover_count)
+{
+	static const uint32_t hangovers[] = {0, 1, 3, 25};
+
+	for (size_t i = 0; i < ARRAY_SIZE(hangovers); i++) {
+		VoiceActivityDetector vad = make_vad(2, hangovers[i]);
+
+		for (size_t frame = 0; frame < VOICED_FRAMES; frame++) {
+			vad.Process(voiced, FRAME_LEN);
+		}
+		zassert_true(vad.IsActive());
+
+		zassert_equal(count_hangover(vad, hangovers[i] + 5), hangovers[i],
+			      "hangover %u", hangovers[i]);
+		zassert_false(vad.IsActive());
+
+		/* Stays inactive */
+		zassert_false(vad.Process(quiet, FRAME_LEN));
+	}
+}
+
+ZTEST(kws_vad, test_hangover_restart)
+{
+	VoiceActivityDetector vad = make_vad(2, 3);
+
+	for (size_t frame = 0; frame < VOICED_FRAMES; frame++) {
+		vad.Process(voiced, FRAME_LEN);
+	}
+
+	/* A voiced frame during the hangover starts it again, without a new onset */
+	zassert_true(vad.Process(quiet, FRAME_LEN));
+	zassert_true(vad.Process(quiet, FRAME_LEN));
+	zassert_true(vad.Process(voiced, FRAME_LEN));
+	zassert_equal(count_hangover(vad, 10), 3);
+	zassert_equal(vad.GetStats().onsets, 1);
+
+	/* A new onset needs onsetFrames voiced frames again */
+	zassert_false(vad.Process(voiced, FRAME_LEN));
+	zassert_true(vad.Process(voiced, FRAME_LEN));
+	zassert_equal(vad.GetStats().onsets, 2);
+}
+
+ZTEST(kws_vad, test_block_of_frames)
+{
+	static int16_t block[5 * FRAME_LEN];
+	VoiceActivityDetector vad = make_vad(2, 3);
+
+	for (size_t frame = 0; frame < VOICED_FRAMES; frame++) {
+		vad.Process(voiced, FRAME_LEN);
+	}
+
+	for (size_t frame = 0; frame < ARRAY_SIZE(block) / FRAME_LEN; frame++) {
+		memcpy(block + frame * FRAME_LEN, quiet, sizeof(quiet));
+	}
+
+	/* Active during the first 3 frames of the block, inactive at its end */
+	zassert_true(vad.Process(block, ARRAY_SIZE(block)));
+	zassert_false(vad.IsActive());
+	zassert_false(vad.Process(block, ARRAY_SIZE(block)));
+}
+
+ZTEST_SUITE(kws_vad, NULL, vad_setup, NULL, NULL, NULL);
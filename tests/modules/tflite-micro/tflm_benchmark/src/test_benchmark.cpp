@@ -0,0 +1,190 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "benchmark.hpp"
+#include "model_placement.hpp"
+
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+using namespace InferenceProcess;
+
+#define MAX_SAMPLES 1000
+
+static uint32_t samples[MAX_SAMPLES];
+
+/* 1..count in a fixed scrambled order, 7919 being prime to every count used */
+static void fill_scrambled(size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		samples[i] = (i * 7919) % count + 1;
+	}
+}
+
+ZTEST(tflm_benchmark_stats, test_odd_count)
+{
+	uint32_t odd[] = {50, 10, 40, 20, 30};
+	LatencyStats stats;
+
+	computeLatencyStats(odd, ARRAY_SIZE(odd), stats);
+
+	zassert_equal(stats.min, 10);
+	zassert_equal(stats.median, 30);
+	zassert_equal(stats.p99, 50);
+	zassert_equal(stats.max, 50);
+
+	/* Sorted in place */
+	for (size_t i = 1; i < ARRAY_SIZE(odd); i++) {
+		zassert_true(odd[i - 1] <= odd[i]);
+	}
+}
+
+ZTEST(tflm_benchmark_stats, test_even_count)
+{
+	uint32_t even[] = {40, 10, 30, 20};
+	LatencyStats stats;
+
+	computeLatencyStats(even, ARRAY_SIZE(even), stats);
+
+	zassert_equal(stats.min, 10);
+	zassert_equal(stats.median, 25);
+	zassert_equal(stats.p99, 40);
+	zassert_equal(stats.max, 40);
+}
+
+ZTEST(tflm_benchmark_stats, test_median_overflow)
+{
+	uint32_t large[] = {UINT32_MAX, UINT32_MAX - 2};
+	LatencyStats stats;
+
+	computeLatencyStats(large, ARRAY_SIZE(large), stats);
+
+	zassert_equal(stats.median, UINT32_MAX - 1);
+}
+
+ZTEST(tflm_benchmark_stats, test_p99_nearest_rank)
+{
+	static const struct {
+		size_t count;
+		uint32_t p99;
+	} cases[] = {
+		{1, 1}, {10, 10}, {100, 99}, {200, 198}, {1000, 990},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		LatencyStats stats;
+
+		fill_scrambled(cases[i].count);
+		computeLatencyStats(samples, cases[i].count, stats);
+
+		zassert_equal(stats.min, 1);
+		zassert_equal(stats.max, cases[i].count);
+		zassert_equal(stats.p99, cases[i].p99, "count %zu: p99 %u", cases[i].count,
+			      stats.p99);
+	}
+}
+
+ZTEST(tflm_benchmark_stats, test_no_samples)
+{
+	LatencyStats stats = {1, 2, 3, 4};
+
+	computeLatencyStats(samples, 0, stats);
+
+	zassert_equal(stats.min, 0);
+	zassert_equal(stats.median, 0);
+	zassert_equal(stats.p99, 0);
+	zassert_equal(stats.max, 0);
+}
+
+ZTEST_SUITE(tflm_benchmark_stats, NULL, NULL, NULL, NULL, NULL);
+
+#define POOL_SIZE  64
+#define MODEL_SIZE 40
+
+static uint8_t __aligned(16) pool[POOL_SIZE];
+static uint8_t model_data[2][MODEL_SIZE];
+
+static void *model_pool_setup(void)
+{
+	for (size_t i = 0; i < sizeof(model_data); i++) {
+		model_data[i / MODEL_SIZE][i % MODEL_SIZE] = i;
+	}
+
+	return NULL;
+}
+
+ZTEST(tflm_benchmark_placement, test_in_place)
+{
+	ModelPool modelPool(pool, sizeof(pool));
+	DataPtr model(model_data[0], MODEL_SIZE);
+	DataPtr placed;
+
+	zassert_false(modelPool.place(model, ModelPlacement::InPlace, placed));
+	zassert_equal(placed.data, model.data);
+	zassert_equal(placed.size, MODEL_SIZE);
+	zassert_equal(modelPool.getUsed(), 0);
+}
+
+ZTEST(tflm_benchmark_placement, test_sram)
+{
+	ModelPool modelPool(pool, sizeof(pool));
+	DataPtr placed;
+	DataPtr again;
+
+	zassert_false(modelPool.place(DataPtr(model_data[0], MODEL_SIZE), ModelPlacement::Sram,
+				      placed));
+	zassert_true(modelPool.contains(placed.data));
+	zassert_equal(reinterpret_cast<uintptr_t>(placed.data) % 16, 0);
+	zassert_equal(placed.size, MODEL_SIZE);
+	zassert_mem_equal(placed.data, model_data[0], MODEL_SIZE);
+	zassert_equal(modelPool.getUsed(), MODEL_SIZE);
+
+	/* Already in the pool, not copied again */
+	zassert_false(modelPool.place(placed, ModelPlacement::Sram, again));
+	zassert_equal(again.data, placed.data);
+	zassert_equal(modelPool.getUsed(), MODEL_SIZE);
+
+	/* The second model starts at offset 48, 16 bytes are left */
+	zassert_equal(modelPool.getFree(), POOL_SIZE - 48);
+	zassert_true(modelPool.place(DataPtr(model_data[1], MODEL_SIZE), ModelPlacement::Sram,
+				     again),
+		     "model larger than the free pool placed");
+
+	/* The first copy is left alone */
+	zassert_mem_equal(placed.data, model_data[0], MODEL_SIZE);
+}
+
+ZTEST(tflm_benchmark_placement, test_sram_if_fits)
+{
+	ModelPool modelPool(pool, sizeof(pool));
+	DataPtr first;
+	DataPtr second;
+
+	zassert_false(modelPool.place(DataPtr(model_data[0], MODEL_SIZE),
+				      ModelPlacement::SramIfFits, first));
+	zassert_true(modelPool.contains(first.data));
+
+	/* Does not fit, read in place */
+	zassert_false(modelPool.place(DataPtr(model_data[1], MODEL_SIZE),
+				      ModelPlacement::SramIfFits, second));
+	zassert_equal(second.data, model_data[1]);
+	zassert_equal(modelPool.getUsed(), MODEL_SIZE);
+
+	/* Fits once the pool is reset */
+	modelPool.reset();
+	zassert_equal(modelPool.getUsed(), 0);
+	zassert_equal(modelPool.getFree(), POOL_SIZE);
+	zassert_false(modelPool.place(DataPtr(model_data[1], MODEL_SIZE),
+				      ModelPlacement::SramIfFits, second));
+	zassert_equal(second.data, pool);
+	zassert_mem_equal(pool, model_data[1], MODEL_SIZE);
+}
+
+ZTEST_SUITE(tflm_benchmark_placement, NULL, model_pool_setup, NULL, NULL, NULL);